@@ -0,0 +1,73 @@
+#include "bool_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+BoolColumnGenerator::BoolColumnGenerator(const uint64_t seed, const idx_t column_idx, const double true_probability)
+    : ColumnGenerator(LogicalType::BOOLEAN), rng(seed, column_idx), true_probability(true_probability) {
+    D_ASSERT(true_probability >= 0 && true_probability <= 1);
+    if (true_probability == 0) {
+        constant_value = false;
+    } else if (true_probability == 1) {
+        constant_value = true;
+    } else {
+        true_threshold = ProbabilityThreshold(true_probability);
+    }
+}
+
+void BoolColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().id() == LogicalTypeId::BOOLEAN);
+
+    if (constant_value.has_value()) {
+        // A constant vector holds a single value for all rows
+        result.Reference(Value::BOOLEAN(constant_value.value()));
+    } else {
+        D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+        auto data = FlatVector::GetData<bool>(result);
+        if (true_probability == 0.5) {
+            // Every random word provides the values of 64 consecutive rowids
+            // No rowid belongs to this block, so the first row always draws a word
+            uint64_t block = UINT64_MAX;
+            uint64_t word = 0;
+            for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+                const uint64_t rowid = rowids[row_idx];
+                if (rowid / 64 != block) {
+                    block = rowid / 64;
+                    word = rng.Word(block);
+                }
+                data[row_idx] = (word >> (rowid % 64)) & 1;
+            }
+        } else {
+            uint64_t words[STANDARD_VECTOR_SIZE];
+            rng.FillWords(rowids, count, words);
+            for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+                data[row_idx] = words[row_idx] < true_threshold;
+            }
+        }
+    }
+}
+
+BaseStatistics BoolColumnGenerator::GetStatistics() const {
+    if (constant_value.has_value()) {
+        return BaseStatistics::FromConstant(Value::BOOLEAN(constant_value.value()));
+    }
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    NumericStats::SetMin(stats, Value::BOOLEAN(false));
+    NumericStats::SetMax(stats, Value::BOOLEAN(true));
+    stats.SetDistinctCount(2);
+    return stats;
+}
+
+} // namespace duckdb_faker
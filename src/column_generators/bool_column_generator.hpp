@@ -0,0 +1,27 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+class BoolColumnGenerator final : public ColumnGenerator {
+public:
+    BoolColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, double true_probability);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    CounterRng rng;
+    double true_probability;
+    // A uniform 64-bit word below this threshold yields true
+    uint64_t true_threshold = 0;
+    // If true_probability is 0 or 1, we can return a constant value
+    std::optional<bool> constant_value;
+};
+
+} // namespace duckdb_faker
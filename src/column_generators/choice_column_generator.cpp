@@ -0,0 +1,69 @@
+#include "choice_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "rng/alias_table.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+ChoiceColumnGenerator::ChoiceColumnGenerator(const uint64_t seed, const idx_t column_idx, LogicalType type,
+                                             const vector<Value>& values, const std::vector<double>& weights)
+    : ColumnGenerator(std::move(type)), rng(seed, column_idx), alias_table(weights), pool_size(values.size()) {
+    D_ASSERT(!values.empty());
+    D_ASSERT(values.size() == weights.size());
+    // The pool ends with a NULL entry for NullableColumnGenerator
+    pool = make_uniq<Vector>(this->type, pool_size + 1);
+    for (idx_t i = 0; i < pool_size; i++) {
+        pool->SetValue(i, values[i]);
+    }
+    FlatVector::SetNull(*pool, pool_size, true);
+
+    // Values with weight 0 are never picked, so a single positive weight means a constant
+    statistics = BaseStatistics::CreateEmpty(this->type).ToUnique();
+    idx_t num_possible_values = 0;
+    for (idx_t i = 0; i < pool_size; i++) {
+        if (weights[i] > 0) {
+            num_possible_values++;
+            constant_value = values[i];
+            statistics->Merge(BaseStatistics::FromConstant(values[i]));
+        }
+    }
+    statistics->SetDistinctCount(num_possible_values);
+    if (num_possible_values != 1) {
+        constant_value.reset();
+    }
+}
+
+BaseStatistics ChoiceColumnGenerator::GetStatistics() const {
+    return statistics->Copy();
+}
+
+void ChoiceColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType() == type);
+    if (constant_value.has_value()) {
+        result.Reference(constant_value.value());
+        return;
+    }
+
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+    // The dictionary buffer of the result keeps the selection alive
+    SelectionVector sel(count);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        sel.set_index(row_idx, alias_table.Sample(words[row_idx]));
+    }
+    result.Dictionary(*pool, pool_size + 1, sel, count);
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "rng/alias_table.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace duckdb_faker {
+
+// Picks one of the given values per row according to the weights.
+// The result is a dictionary vector over a pool that holds every value once, so values are never copied.
+class ChoiceColumnGenerator final : public ColumnGenerator {
+public:
+    ChoiceColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, duckdb::LogicalType type,
+                          const duckdb::vector<duckdb::Value>& values, const std::vector<double>& weights);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    CounterRng rng;
+    AliasTable alias_table;
+    // Only read during generation, so it can be shared by all threads
+    duckdb::unique_ptr<duckdb::Vector> pool;
+    duckdb::idx_t pool_size;
+    // Statistics of the values that can be picked
+    duckdb::unique_ptr<duckdb::BaseStatistics> statistics;
+    // If only one value can be picked, we can return a constant value
+    std::optional<duckdb::Value> constant_value;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace duckdb {
+class Vector;
+}
+
+namespace duckdb_faker {
+
+// Generates the values of a single output column.
+// Values only depend on the rowids, so one generator can be shared by all threads of a scan.
+class ColumnGenerator {
+public:
+    explicit ColumnGenerator(duckdb::LogicalType type) : type(std::move(type)) {
+    }
+    virtual ~ColumnGenerator() = default;
+
+    // Writes the values for the given rows to result[0, count).
+    // Dictionaries of pooled values end with a NULL entry that no row selects, so that NullableColumnGenerator can
+    // make rows NULL without flattening the dictionary.
+    virtual void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const = 0;
+
+    // Returns statistics that hold for every generated value, which lets the optimizer prune filters and narrow
+    // types. The distinct count is the number of possible values, regardless of the number of rows.
+    // Generators only produce NULLs when wrapped in a NullableColumnGenerator.
+    virtual duckdb::BaseStatistics GetStatistics() const {
+        auto stats = duckdb::BaseStatistics::CreateUnknown(type);
+        stats.Set(duckdb::StatsInfo::CANNOT_HAVE_NULL_VALUES);
+        return stats;
+    }
+
+    const duckdb::LogicalType type;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,405 @@
+#include "column_generator_factory.hpp"
+
+#include "bool_column_generator.hpp"
+#include "choice_column_generator.hpp"
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/hugeint.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/cast_helpers.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/uhugeint.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "float_column_generator.hpp"
+#include "frequent_values_column_generator.hpp"
+#include "int_column_generator.hpp"
+#include "interval_column_generator.hpp"
+#include "list_column_generator.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "string_column_generator.hpp"
+#include "struct_column_generator.hpp"
+#include "table_functions/probability_distributions.hpp"
+#include "table_functions/string_casing.hpp"
+#include "table_functions/table_profile.hpp"
+#include "table_functions/temporal.hpp"
+#include "unique_string_column_generator.hpp"
+#include "uuid_column_generator.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the keys of the children of nested types from each other and from their parent
+constexpr uint64_t CHILD_SEED_KEY = 0xA54FF53A5F1D36F1ULL;
+
+uint64_t derive_child_seed(const uint64_t seed, const idx_t child_idx) {
+    return CounterRng::Mix(seed ^ CounterRng::Mix(child_idx + CHILD_SEED_KEY));
+}
+
+template <typename T>
+unique_ptr<ColumnGenerator> create_int_generator(const uint64_t seed, const idx_t column_idx) {
+    return make_uniq<IntColumnGenerator<T>>(seed,
+                                            column_idx,
+                                            NumericLimits<T>::Minimum(),
+                                            NumericLimits<T>::Maximum(),
+                                            ProbabilityDistribution::Type::UNIFORM);
+}
+
+unique_ptr<ColumnGenerator> create_epoch_generator(const LogicalType& type, const uint64_t seed, const idx_t column_idx,
+                                                   const int64_t min, const int64_t max) {
+    return make_uniq<IntColumnGenerator<int64_t>>(
+        type, seed, column_idx, min, max, ProbabilityDistribution::Type::UNIFORM);
+}
+
+template <typename T>
+unique_ptr<ColumnGenerator> create_decimal_generator(const LogicalType& type, const uint64_t seed,
+                                                     const idx_t column_idx, const Value& min, const Value& max) {
+    // The largest scaled integer with as many digits as the width
+    T limit;
+    if constexpr (std::is_same_v<T, hugeint_t>) {
+        limit = Hugeint::POWERS_OF_TEN[DecimalType::GetWidth(type)] - 1;
+    } else {
+        limit = static_cast<T>(NumericHelper::POWERS_OF_TEN[DecimalType::GetWidth(type)] - 1);
+    }
+
+    const T min_value = min.IsNull() ? static_cast<T>(-limit) : min.DefaultCastAs(type).GetValueUnsafe<T>();
+    const T max_value = max.IsNull() ? limit : max.DefaultCastAs(type).GetValueUnsafe<T>();
+    if (min_value > max_value) {
+        throw InvalidInputException("Minimum value must be less than or equal to maximum value");
+    }
+
+    return make_uniq<IntColumnGenerator<T>>(
+        type, seed, column_idx, min_value, max_value, ProbabilityDistribution::Type::UNIFORM);
+}
+
+// Unique values come from a permutation of [0, domain_size) added to min, where 0 denotes 2^64
+template <typename T>
+unique_ptr<ColumnGenerator> create_unique_int_generator(const LogicalType& type, const uint64_t seed,
+                                                        const idx_t column_idx, const T min,
+                                                        const uint64_t domain_size, const uint64_t num_rows) {
+    if (domain_size != 0 && num_rows > domain_size) {
+        throw InvalidInputException("Cannot generate %llu unique values of type %s, which only has %llu values",
+                                    num_rows,
+                                    type.ToString(),
+                                    domain_size);
+    }
+    return IntColumnGenerator<T>::Unique(type, seed, column_idx, min, domain_size);
+}
+
+template <typename T>
+unique_ptr<ColumnGenerator> create_unique_int_generator(const LogicalType& type, const uint64_t seed,
+                                                        const idx_t column_idx, const uint64_t num_rows) {
+    if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+        const uint64_t domain_size = static_cast<uint64_t>(static_cast<int64_t>(NumericLimits<T>::Maximum()) -
+                                                           static_cast<int64_t>(NumericLimits<T>::Minimum())) +
+                                     1;
+        return create_unique_int_generator<T>(
+            type, seed, column_idx, NumericLimits<T>::Minimum(), domain_size, num_rows);
+    } else {
+        // 2^64 values are plenty, so 128-bit types use the same values as their 64-bit counterparts
+        T min;
+        if constexpr (std::is_same_v<T, hugeint_t>) {
+            min = hugeint_t(NumericLimits<int64_t>::Minimum());
+        } else if constexpr (std::is_same_v<T, uhugeint_t>) {
+            min = uhugeint_t(static_cast<uint64_t>(0));
+        } else {
+            min = NumericLimits<T>::Minimum();
+        }
+        return create_unique_int_generator<T>(type, seed, column_idx, min, 0, num_rows);
+    }
+}
+
+template <typename T>
+unique_ptr<ColumnGenerator> create_unique_decimal_generator(const LogicalType& type, const uint64_t seed,
+                                                            const idx_t column_idx, const uint64_t num_rows) {
+    if constexpr (std::is_same_v<T, hugeint_t>) {
+        // Decimals stored as hugeint have more than 2^64 values, so only the BIGINT range is used
+        return create_unique_int_generator<T>(
+            type, seed, column_idx, hugeint_t(NumericLimits<int64_t>::Minimum()), 0, num_rows);
+    } else {
+        const int64_t limit = NumericHelper::POWERS_OF_TEN[DecimalType::GetWidth(type)] - 1;
+        return create_unique_int_generator<T>(
+            type, seed, column_idx, static_cast<T>(-limit), static_cast<uint64_t>(2 * limit + 1), num_rows);
+    }
+}
+
+unique_ptr<ColumnGenerator> create_unique_epoch_generator(const LogicalType& type, const uint64_t seed,
+                                                          const idx_t column_idx, const int64_t min,
+                                                          const int64_t max, const uint64_t num_rows) {
+    return create_unique_int_generator<int64_t>(
+        type, seed, column_idx, min, static_cast<uint64_t>(max - min) + 1, num_rows);
+}
+
+unique_ptr<ColumnGenerator> create_histogram_generator(const LogicalType& type, const uint64_t seed,
+                                                       const idx_t column_idx, EquiDepthHistogram histogram) {
+    switch (type.InternalType()) {
+    case PhysicalType::INT8:
+        return IntColumnGenerator<int8_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::INT16:
+        return IntColumnGenerator<int16_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::INT32:
+        return IntColumnGenerator<int32_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::INT64:
+        return IntColumnGenerator<int64_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::UINT8:
+        return IntColumnGenerator<uint8_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::UINT16:
+        return IntColumnGenerator<uint16_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::UINT32:
+        return IntColumnGenerator<uint32_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::UINT64:
+        return IntColumnGenerator<uint64_t>::FromHistogram(type, seed, column_idx, std::move(histogram));
+    case PhysicalType::FLOAT:
+        return FloatColumnGenerator<float>::FromHistogram(seed, column_idx, std::move(histogram));
+    case PhysicalType::DOUBLE:
+        return FloatColumnGenerator<double>::FromHistogram(seed, column_idx, std::move(histogram));
+    case PhysicalType::VARCHAR:
+        return StringColumnGenerator::FromHistogram(seed, column_idx, std::move(histogram));
+    default:
+        throw InternalException("Unsupported type for histograms: %s", type.ToString());
+    }
+}
+} // namespace
+
+unique_ptr<ColumnGenerator> CreateDefaultColumnGenerator(const LogicalType& type, const uint64_t seed,
+                                                         const idx_t column_idx, const ListLengths& list_lengths) {
+    switch (type.id()) {
+    case LogicalTypeId::BOOLEAN:
+        return make_uniq<BoolColumnGenerator>(seed, column_idx, 0.5);
+    case LogicalTypeId::TINYINT:
+        return create_int_generator<int8_t>(seed, column_idx);
+    case LogicalTypeId::SMALLINT:
+        return create_int_generator<int16_t>(seed, column_idx);
+    case LogicalTypeId::INTEGER:
+        return create_int_generator<int32_t>(seed, column_idx);
+    case LogicalTypeId::BIGINT:
+        return create_int_generator<int64_t>(seed, column_idx);
+    case LogicalTypeId::HUGEINT:
+        return create_int_generator<hugeint_t>(seed, column_idx);
+    case LogicalTypeId::UTINYINT:
+        return create_int_generator<uint8_t>(seed, column_idx);
+    case LogicalTypeId::USMALLINT:
+        return create_int_generator<uint16_t>(seed, column_idx);
+    case LogicalTypeId::UINTEGER:
+        return create_int_generator<uint32_t>(seed, column_idx);
+    case LogicalTypeId::UBIGINT:
+        return create_int_generator<uint64_t>(seed, column_idx);
+    case LogicalTypeId::UHUGEINT:
+        return create_int_generator<uhugeint_t>(seed, column_idx);
+    case LogicalTypeId::FLOAT:
+        return make_uniq<FloatColumnGenerator<float>>(seed, column_idx, 0, 1, ProbabilityDistribution::Type::UNIFORM);
+    case LogicalTypeId::DOUBLE:
+        return make_uniq<FloatColumnGenerator<double>>(seed, column_idx, 0, 1, ProbabilityDistribution::Type::UNIFORM);
+    case LogicalTypeId::DECIMAL:
+        return CreateDecimalColumnGenerator(type, seed, column_idx);
+    case LogicalTypeId::DATE:
+        return make_uniq<IntColumnGenerator<int32_t>>(type,
+                                                      seed,
+                                                      column_idx,
+                                                      TemporalDefaults::MinDate().days,
+                                                      TemporalDefaults::MaxDate().days,
+                                                      ProbabilityDistribution::Type::UNIFORM);
+    case LogicalTypeId::TIME:
+        return create_epoch_generator(
+            type, seed, column_idx, TemporalDefaults::MinTime().micros, TemporalDefaults::MaxTime().micros);
+    case LogicalTypeId::TIMESTAMP:
+    case LogicalTypeId::TIMESTAMP_TZ:
+        return create_epoch_generator(
+            type, seed, column_idx, TemporalDefaults::MinTimestamp().value, TemporalDefaults::MaxTimestamp().value);
+    case LogicalTypeId::TIMESTAMP_SEC:
+        return create_epoch_generator(type,
+                                      seed,
+                                      column_idx,
+                                      Timestamp::GetEpochSeconds(TemporalDefaults::MinTimestamp()),
+                                      Timestamp::GetEpochSeconds(TemporalDefaults::MaxTimestamp()));
+    case LogicalTypeId::TIMESTAMP_MS:
+        return create_epoch_generator(type,
+                                      seed,
+                                      column_idx,
+                                      Timestamp::GetEpochMs(TemporalDefaults::MinTimestamp()),
+                                      Timestamp::GetEpochMs(TemporalDefaults::MaxTimestamp()));
+    case LogicalTypeId::TIMESTAMP_NS:
+        return create_epoch_generator(type,
+                                      seed,
+                                      column_idx,
+                                      Timestamp::GetEpochNanoSeconds(TemporalDefaults::MinTimestamp()),
+                                      Timestamp::GetEpochNanoSeconds(TemporalDefaults::MaxTimestamp()));
+    case LogicalTypeId::INTERVAL:
+        return make_uniq<IntervalColumnGenerator>(
+            seed, column_idx, TemporalDefaults::MinInterval(), TemporalDefaults::MaxInterval());
+    case LogicalTypeId::UUID:
+        return make_uniq<UuidColumnGenerator>(seed, column_idx, 4);
+    case LogicalTypeId::VARCHAR:
+        return make_uniq<StringColumnGenerator>(
+            seed, column_idx, 1, StringColumnGenerator::DefaultMaxLength(1), StringCasing::Lower);
+    case LogicalTypeId::LIST:
+    case LogicalTypeId::MAP:
+    case LogicalTypeId::ARRAY: {
+        const LogicalType& child_type =
+            type.id() == LogicalTypeId::ARRAY ? ArrayType::GetChildType(type) : ListType::GetChildType(type);
+        auto child = CreateDefaultColumnGenerator(child_type, derive_child_seed(seed, 0), column_idx, list_lengths);
+        return make_uniq<ListColumnGenerator>(
+            type, seed, column_idx, list_lengths.min, list_lengths.max, std::move(child));
+    }
+    case LogicalTypeId::STRUCT: {
+        vector<unique_ptr<ColumnGenerator>> fields;
+        const auto& child_types = StructType::GetChildTypes(type);
+        for (idx_t field_idx = 0; field_idx < child_types.size(); field_idx++) {
+            fields.push_back(CreateDefaultColumnGenerator(
+                child_types[field_idx].second, derive_child_seed(seed, field_idx), column_idx, list_lengths));
+        }
+        return make_uniq<StructColumnGenerator>(type, std::move(fields));
+    }
+    default:
+        throw NotImplementedException("Random data generation not implemented for type: %s", type.ToString());
+    }
+}
+
+unique_ptr<ColumnGenerator> CreateDecimalColumnGenerator(const LogicalType& type, const uint64_t seed,
+                                                         const idx_t column_idx, const Value& min, const Value& max) {
+    D_ASSERT(type.id() == LogicalTypeId::DECIMAL);
+    switch (type.InternalType()) {
+    case PhysicalType::INT16:
+        return create_decimal_generator<int16_t>(type, seed, column_idx, min, max);
+    case PhysicalType::INT32:
+        return create_decimal_generator<int32_t>(type, seed, column_idx, min, max);
+    case PhysicalType::INT64:
+        return create_decimal_generator<int64_t>(type, seed, column_idx, min, max);
+    case PhysicalType::INT128:
+        return create_decimal_generator<hugeint_t>(type, seed, column_idx, min, max);
+    default:
+        throw InternalException("Unsupported physical type for DECIMAL: %s", TypeIdToString(type.InternalType()));
+    }
+}
+
+unique_ptr<ColumnGenerator> CreateUniqueColumnGenerator(const LogicalType& type, const uint64_t seed,
+                                                        const idx_t column_idx, const uint64_t num_rows) {
+    const timestamp_t min_timestamp = TemporalDefaults::MinTimestamp();
+    const timestamp_t max_timestamp = TemporalDefaults::MaxTimestamp();
+    switch (type.id()) {
+    case LogicalTypeId::TINYINT:
+        return create_unique_int_generator<int8_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::SMALLINT:
+        return create_unique_int_generator<int16_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::INTEGER:
+        return create_unique_int_generator<int32_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::BIGINT:
+        return create_unique_int_generator<int64_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::HUGEINT:
+        return create_unique_int_generator<hugeint_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::UTINYINT:
+        return create_unique_int_generator<uint8_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::USMALLINT:
+        return create_unique_int_generator<uint16_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::UINTEGER:
+        return create_unique_int_generator<uint32_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::UBIGINT:
+        return create_unique_int_generator<uint64_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::UHUGEINT:
+        return create_unique_int_generator<uhugeint_t>(type, seed, column_idx, num_rows);
+    case LogicalTypeId::DECIMAL:
+        switch (type.InternalType()) {
+        case PhysicalType::INT16:
+            return create_unique_decimal_generator<int16_t>(type, seed, column_idx, num_rows);
+        case PhysicalType::INT32:
+            return create_unique_decimal_generator<int32_t>(type, seed, column_idx, num_rows);
+        case PhysicalType::INT64:
+            return create_unique_decimal_generator<int64_t>(type, seed, column_idx, num_rows);
+        case PhysicalType::INT128:
+            return create_unique_decimal_generator<hugeint_t>(type, seed, column_idx, num_rows);
+        default:
+            throw InternalException("Unsupported physical type for DECIMAL: %s", TypeIdToString(type.InternalType()));
+        }
+    case LogicalTypeId::DATE: {
+        const int32_t min = TemporalDefaults::MinDate().days;
+        const int32_t max = TemporalDefaults::MaxDate().days;
+        return create_unique_int_generator<int32_t>(
+            type, seed, column_idx, min, static_cast<uint64_t>(max - min) + 1, num_rows);
+    }
+    case LogicalTypeId::TIME:
+        return create_unique_epoch_generator(
+            type, seed, column_idx, TemporalDefaults::MinTime().micros, TemporalDefaults::MaxTime().micros, num_rows);
+    case LogicalTypeId::TIMESTAMP:
+    case LogicalTypeId::TIMESTAMP_TZ:
+        return create_unique_epoch_generator(
+            type, seed, column_idx, min_timestamp.value, max_timestamp.value, num_rows);
+    case LogicalTypeId::TIMESTAMP_SEC:
+        return create_unique_epoch_generator(type,
+                                             seed,
+                                             column_idx,
+                                             Timestamp::GetEpochSeconds(min_timestamp),
+                                             Timestamp::GetEpochSeconds(max_timestamp),
+                                             num_rows);
+    case LogicalTypeId::TIMESTAMP_MS:
+        return create_unique_epoch_generator(type,
+                                             seed,
+                                             column_idx,
+                                             Timestamp::GetEpochMs(min_timestamp),
+                                             Timestamp::GetEpochMs(max_timestamp),
+                                             num_rows);
+    case LogicalTypeId::TIMESTAMP_NS:
+        return create_unique_epoch_generator(type,
+                                             seed,
+                                             column_idx,
+                                             Timestamp::GetEpochNanoSeconds(min_timestamp),
+                                             Timestamp::GetEpochNanoSeconds(max_timestamp),
+                                             num_rows);
+    case LogicalTypeId::VARCHAR: {
+        const uint32_t length = UniqueStringColumnGenerator::RequiredLength(num_rows);
+        if (length > UniqueStringColumnGenerator::MAX_LENGTH) {
+            throw InvalidInputException("Cannot generate %llu unique values of type VARCHAR", num_rows);
+        }
+        return make_uniq<UniqueStringColumnGenerator>(seed, column_idx, length);
+    }
+    case LogicalTypeId::UUID:
+        return UuidColumnGenerator::Unique(seed, column_idx);
+    default:
+        throw NotImplementedException("Unique values are not supported for type: %s", type.ToString());
+    }
+}
+
+bool SupportsUniqueValues(const LogicalType& type, const uint64_t num_rows) {
+    try {
+        CreateUniqueColumnGenerator(type, 0, 0, num_rows);
+        return true;
+    } catch (const NotImplementedException&) {
+        return false;
+    } catch (const InvalidInputException&) {
+        return false;
+    }
+}
+
+unique_ptr<ColumnGenerator> CreateProfiledColumnGenerator(const LogicalType& type, const uint64_t seed,
+                                                          const idx_t column_idx, const ColumnProfile& profile,
+                                                          const ListLengths& list_lengths) {
+    if (!profile.has_other_values) {
+        if (profile.frequent_values.empty()) {
+            // The sample only contains NULLs
+            return CreateDefaultColumnGenerator(type, seed, column_idx, list_lengths);
+        }
+        return make_uniq<ChoiceColumnGenerator>(seed, column_idx, type, profile.frequent_values, profile.frequencies);
+    }
+
+    unique_ptr<ColumnGenerator> other;
+    if (profile.boundaries.empty()) {
+        other = CreateDefaultColumnGenerator(type, seed, column_idx, list_lengths);
+    } else {
+        other = create_histogram_generator(type, seed, column_idx, EquiDepthHistogram(profile.boundaries));
+    }
+    if (profile.frequent_values.empty()) {
+        return other;
+    }
+    return make_uniq<FrequentValuesColumnGenerator>(
+        seed, column_idx, profile.frequent_values, profile.frequencies, std::move(other));
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "table_functions/table_profile.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Range of the number of elements of generated LIST and MAP values
+struct ListLengths {
+    uint32_t min = 0;
+    uint32_t max = 5;
+};
+
+// Creates a generator with default parameters for a column of the given type.
+// Nested types are generated recursively, each child with its own RNG key.
+// Throws a NotImplementedException if there is no generator for the type.
+duckdb::unique_ptr<ColumnGenerator> CreateDefaultColumnGenerator(const duckdb::LogicalType& type, uint64_t seed,
+                                                                 duckdb::idx_t column_idx,
+                                                                 const ListLengths& list_lengths = {});
+
+// Creates a generator for a DECIMAL type, which samples the scaled integer in the physical type of the decimal.
+// min and max are cast to the decimal type; NULL stands for the smallest or largest value of its width.
+duckdb::unique_ptr<ColumnGenerator> CreateDecimalColumnGenerator(const duckdb::LogicalType& type, uint64_t seed,
+                                                                 duckdb::idx_t column_idx,
+                                                                 const duckdb::Value& min = duckdb::Value(),
+                                                                 const duckdb::Value& max = duckdb::Value());
+
+// Creates a generator whose values are distinct for the rowids [0, num_rows), for example for a PRIMARY KEY.
+// Throws a NotImplementedException if unique values are not supported for the type,
+// and an InvalidInputException if the type does not have num_rows distinct values.
+duckdb::unique_ptr<ColumnGenerator> CreateUniqueColumnGenerator(const duckdb::LogicalType& type, uint64_t seed,
+                                                                duckdb::idx_t column_idx, uint64_t num_rows);
+// Returns whether CreateUniqueColumnGenerator can create num_rows distinct values of the type
+bool SupportsUniqueValues(const duckdb::LogicalType& type, uint64_t num_rows);
+
+// Creates a generator that reproduces a profiled column: its frequent values are picked with their frequencies,
+// and the other values follow the histogram of the profile or the default generator of the type.
+// NULLs are left to the caller, which knows the NULL fraction of the profile.
+duckdb::unique_ptr<ColumnGenerator> CreateProfiledColumnGenerator(const duckdb::LogicalType& type, uint64_t seed,
+                                                                  duckdb::idx_t column_idx,
+                                                                  const ColumnProfile& profile,
+                                                                  const ListLengths& list_lengths = {});
+
+} // namespace duckdb_faker
@@ -0,0 +1,162 @@
+#include "float_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "rng/normal_kernel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+template <typename T>
+LogicalType float_type() {
+    if constexpr (std::is_same_v<T, float>) {
+        return LogicalType::FLOAT;
+    } else {
+        static_assert(std::is_same_v<T, double>);
+        return LogicalType::DOUBLE;
+    }
+}
+
+// Maps a random word to [0, 1) by using its upper bits as the mantissa of a number in [1, 2) and subtracting 1
+template <typename T>
+T unit_interval(const uint64_t word) {
+    if constexpr (std::is_same_v<T, float>) {
+        return std::bit_cast<float>(static_cast<uint32_t>(0x3F800000U | (word >> 41))) - 1.0F;
+    } else {
+        return std::bit_cast<double>(0x3FF0000000000000ULL | (word >> 12)) - 1.0;
+    }
+}
+} // namespace
+
+template <typename T>
+FloatColumnGenerator<T>::FloatColumnGenerator(const uint64_t seed, const idx_t column_idx, const T min, const T max,
+                                              const ProbabilityDistribution::Type distribution,
+                                              const DistributionParameters parameters)
+    : ColumnGenerator(float_type<T>()), rng(seed, column_idx), min(min), max(max), distribution(distribution),
+      parameters(parameters) {
+    D_ASSERT(min <= max);
+    if (min == max) {
+        constant_value = min;
+    } else if (distribution == ProbabilityDistribution::Type::NORMAL && parameters.stddev == 0) {
+        constant_value = Clamp(parameters.mean);
+    }
+}
+
+template <typename T>
+void FloatColumnGenerator<T>::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().id() == float_type<T>().id());
+    if (constant_value.has_value()) {
+        result.Reference(Value::CreateValue<T>(constant_value.value()));
+        return;
+    }
+
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    T* data = FlatVector::GetData<T>(result);
+    if (histogram.has_value()) {
+        GenerateHistogram(rowids, count, data);
+        return;
+    }
+    switch (distribution) {
+    case ProbabilityDistribution::Type::UNIFORM:
+        GenerateUniform(rowids, count, data);
+        break;
+    case ProbabilityDistribution::Type::NORMAL:
+        GenerateNormal(rowids, count, data);
+        break;
+    default:
+        throw InternalException("Unsupported probability distribution");
+    }
+}
+
+template <typename T>
+unique_ptr<FloatColumnGenerator<T>> FloatColumnGenerator<T>::FromHistogram(const uint64_t seed, const idx_t column_idx,
+                                                                           EquiDepthHistogram histogram) {
+    const auto min = static_cast<T>(histogram.Min());
+    const auto max = static_cast<T>(histogram.Max());
+    auto generator =
+        make_uniq<FloatColumnGenerator<T>>(seed, column_idx, min, max, ProbabilityDistribution::Type::UNIFORM);
+    if (min != max) {
+        generator->histogram.emplace(std::move(histogram));
+    }
+    return generator;
+}
+
+template <typename T>
+BaseStatistics FloatColumnGenerator<T>::GetStatistics() const {
+    if (constant_value.has_value()) {
+        return BaseStatistics::FromConstant(Value::CreateValue<T>(constant_value.value()));
+    }
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    NumericStats::SetMin(stats, Value::CreateValue<T>(min));
+    NumericStats::SetMax(stats, Value::CreateValue<T>(max));
+    return stats;
+}
+
+template <typename T>
+void FloatColumnGenerator<T>::GenerateUniform(const uint64_t* rowids, const idx_t count, T* data) const {
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+
+    const T width = max - min;
+    if (std::isfinite(width)) {
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            // Rounding can push the value slightly beyond max
+            data[row_idx] = std::min(min + unit_interval<T>(words[row_idx]) * width, max);
+        }
+    } else {
+        // The width overflows for ranges spanning most of the type, so interpolate between the bounds instead
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            const T fraction = unit_interval<T>(words[row_idx]);
+            data[row_idx] = std::min(min * (1 - fraction) + max * fraction, max);
+        }
+    }
+}
+
+template <typename T>
+void FloatColumnGenerator<T>::GenerateNormal(const uint64_t* rowids, const idx_t count, T* data) const {
+    double values[STANDARD_VECTOR_SIZE];
+    FillStandardNormal(rng, rowids, count, values);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx] = Clamp(parameters.mean + parameters.stddev * values[row_idx]);
+    }
+}
+
+template <typename T>
+void FloatColumnGenerator<T>::GenerateHistogram(const uint64_t* rowids, const idx_t count, T* data) const {
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+    double values[STANDARD_VECTOR_SIZE];
+    histogram->Sample(words, count, values);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx] = Clamp(values[row_idx]);
+    }
+}
+
+template <typename T>
+T FloatColumnGenerator<T>::Clamp(const double value) const {
+    // Values beyond the range of float become infinite when converted, so clamp them as doubles
+    return static_cast<T>(std::clamp(value, static_cast<double>(min), static_cast<double>(max)));
+}
+
+template class FloatColumnGenerator<float>;
+template class FloatColumnGenerator<double>;
+
+} // namespace duckdb_faker
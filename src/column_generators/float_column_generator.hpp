@@ -0,0 +1,50 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "table_functions/probability_distributions.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+// Generates floating-point numbers of the physical type T, which is float or double.
+// Uniform values are built from the random bits directly, without any division per row.
+template <typename T>
+class FloatColumnGenerator final : public ColumnGenerator {
+public:
+    // Uniform values lie in [min, max]. Values of the normal distribution are clamped to [min, max].
+    FloatColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, T min, T max,
+                         ProbabilityDistribution::Type distribution, DistributionParameters parameters = {});
+
+    // Creates a generator of values that follow the histogram
+    static duckdb::unique_ptr<FloatColumnGenerator> FromHistogram(uint64_t seed, duckdb::idx_t column_idx,
+                                                                  EquiDepthHistogram histogram);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    void GenerateUniform(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateNormal(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateHistogram(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    T Clamp(double value) const;
+
+    CounterRng rng;
+    T min;
+    T max;
+    ProbabilityDistribution::Type distribution;
+    DistributionParameters parameters;
+    // Only set for generators that follow a histogram
+    std::optional<EquiDepthHistogram> histogram;
+    // If min and max are equal or the standard deviation is 0, we can return a constant value
+    std::optional<T> constant_value;
+};
+
+extern template class FloatColumnGenerator<float>;
+extern template class FloatColumnGenerator<double>;
+
+} // namespace duckdb_faker
@@ -0,0 +1,38 @@
+#include "foreign_key_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the sampled rows from the values of the column at the same position
+constexpr uint64_t FOREIGN_KEY_SEED_KEY = 0x510E527FADE682D1ULL;
+} // namespace
+
+ForeignKeyColumnGenerator::ForeignKeyColumnGenerator(unique_ptr<ColumnGenerator> parent_generator,
+                                                     const uint64_t seed, const idx_t key_idx,
+                                                     const uint64_t parent_rows)
+    : ColumnGenerator(parent_generator->type), parent_generator(std::move(parent_generator)),
+      rng(seed ^ FOREIGN_KEY_SEED_KEY, key_idx), parent_rows(parent_rows) {
+    D_ASSERT(parent_rows > 0);
+}
+
+void ForeignKeyColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    uint64_t parent_rowids[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, parent_rowids);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        // The bias of the multiply-shift is negligible for the at most 2^63 rows of the referenced table
+        parent_rowids[row_idx] = BoundedUint64(parent_rowids[row_idx], parent_rows);
+    }
+    parent_generator->Generate(parent_rowids, count, result);
+}
+
+} // namespace duckdb_faker
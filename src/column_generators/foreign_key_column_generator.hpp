@@ -0,0 +1,32 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Generates values of a foreign key by sampling a row of the referenced table and generating the value
+// that the referenced table has in this row. Hence, no lookup of the referenced table is needed.
+class ForeignKeyColumnGenerator final : public ColumnGenerator {
+public:
+    // parent_generator must generate the referenced column for the rowids [0, parent_rows).
+    // The columns of a compound foreign key pass the same key_idx, so that they sample the same rows.
+    ForeignKeyColumnGenerator(duckdb::unique_ptr<ColumnGenerator> parent_generator, uint64_t seed,
+                              duckdb::idx_t key_idx, uint64_t parent_rows);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    // The values are a subset of the values of the referenced column
+    duckdb::BaseStatistics GetStatistics() const override {
+        return parent_generator->GetStatistics();
+    }
+
+private:
+    duckdb::unique_ptr<ColumnGenerator> parent_generator;
+    CounterRng rng;
+    uint64_t parent_rows;
+};
+
+} // namespace duckdb_faker
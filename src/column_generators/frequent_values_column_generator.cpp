@@ -0,0 +1,130 @@
+#include "frequent_values_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "rng/alias_table.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the choice between frequent and other values from the values of the other generator
+constexpr uint64_t FREQUENT_VALUES_SEED_KEY = 0x9B05688C2B3E6C1FULL;
+
+std::vector<double> with_other_frequency(std::vector<double> frequencies) {
+    const double total = std::accumulate(frequencies.begin(), frequencies.end(), 0.0);
+    frequencies.push_back(std::max(1.0 - total, 0.0));
+    return frequencies;
+}
+
+// Values of nested types span several vectors, so they cannot be moved as a whole
+bool is_nested(const LogicalType& type) {
+    switch (type.InternalType()) {
+    case PhysicalType::STRUCT:
+    case PhysicalType::LIST:
+    case PhysicalType::ARRAY:
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace
+
+FrequentValuesColumnGenerator::FrequentValuesColumnGenerator(const uint64_t seed, const idx_t column_idx,
+                                                             const vector<Value>& values,
+                                                             const std::vector<double>& frequencies,
+                                                             unique_ptr<ColumnGenerator> other)
+    : ColumnGenerator(other->type), rng(seed ^ FREQUENT_VALUES_SEED_KEY, column_idx),
+      alias_table(with_other_frequency(frequencies)), pool_size(values.size()), other(std::move(other)) {
+    D_ASSERT(!values.empty());
+    D_ASSERT(values.size() == frequencies.size());
+    // The pool ends with a NULL entry for NullableColumnGenerator
+    pool = make_uniq<Vector>(type, pool_size + 1);
+    for (idx_t i = 0; i < pool_size; i++) {
+        pool->SetValue(i, values[i]);
+    }
+    FlatVector::SetNull(*pool, pool_size, true);
+}
+
+void FrequentValuesColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+
+    // Frequent values select their pool entry, the other rows select the values generated after the pool
+    SelectionVector sel(count);
+    uint64_t other_rowids[STANDARD_VECTOR_SIZE];
+    idx_t other_count = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        const uint64_t pick = alias_table.Sample(words[row_idx]);
+        if (pick < pool_size) {
+            sel.set_index(row_idx, pick);
+        } else {
+            sel.set_index(row_idx, pool_size + other_count);
+            other_rowids[other_count++] = rowids[row_idx];
+        }
+    }
+
+    if (other_count == 0) {
+        // All threads share the pool as the dictionary of their chunks
+        result.Dictionary(*pool, pool_size + 1, sel, count);
+        return;
+    }
+    if (is_nested(type)) {
+        Vector values(type, pool_size + other_count);
+        VectorOperations::Copy(*pool, values, pool_size, 0, 0);
+        Vector other_values(type, other_count);
+        other->Generate(other_rowids, other_count, other_values);
+        VectorOperations::Copy(other_values, values, other_count, 0, pool_size);
+        result.Dictionary(values, pool_size + other_count, sel, count);
+        return;
+    }
+
+    // Only the other values are materialized. They are generated into the result and moved to their rows,
+    // while the rows of frequent values take the entries of the pool.
+    other->Generate(other_rowids, other_count, result);
+    result.Flatten(other_count);
+    if (type.InternalType() == PhysicalType::VARCHAR) {
+        // Strings of the pool are not copied, so the result keeps their heap alive
+        StringVector::AddHeapReference(result, *pool);
+    }
+    const idx_t width = GetTypeIdSize(type.InternalType());
+    const data_ptr_t data = result.GetData();
+    const const_data_ptr_t pool_data = pool->GetData();
+    auto& validity = FlatVector::Validity(result);
+    // A value only moves to a later row, so going backwards never overwrites a value that has not been moved yet
+    for (idx_t row_idx = count; row_idx-- > 0;) {
+        const idx_t pick = sel.get_index(row_idx);
+        if (pick < pool_size) {
+            memcpy(data + row_idx * width, pool_data + pick * width, width);
+            validity.SetValid(row_idx);
+        } else {
+            other_count--;
+            memmove(data + row_idx * width, data + other_count * width, width);
+            validity.Set(row_idx, validity.RowIsValid(other_count));
+        }
+    }
+}
+
+BaseStatistics FrequentValuesColumnGenerator::GetStatistics() const {
+    auto stats = other->GetStatistics();
+    for (idx_t i = 0; i < pool_size; i++) {
+        stats.Merge(BaseStatistics::FromConstant(pool->GetValue(i)));
+    }
+    return stats;
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "rng/alias_table.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace duckdb_faker {
+
+// Mixes frequent values, which are picked according to their frequencies, with the values of another generator
+// for the remaining rows. This reproduces the most common values of a profiled column exactly.
+class FrequentValuesColumnGenerator final : public ColumnGenerator {
+public:
+    // The frequencies are fractions of all rows, the other generator produces the remaining rows
+    FrequentValuesColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, const duckdb::vector<duckdb::Value>& values,
+                                  const std::vector<double>& frequencies,
+                                  duckdb::unique_ptr<ColumnGenerator> other);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    CounterRng rng;
+    // The last index stands for the other generator
+    AliasTable alias_table;
+    // Only read during generation, so it can be shared by all threads
+    duckdb::unique_ptr<duckdb::Vector> pool;
+    duckdb::idx_t pool_size;
+    duckdb::unique_ptr<ColumnGenerator> other;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,377 @@
+#include "int_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/hugeint.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/uhugeint.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "rng/bounded_int_kernel.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "rng/feistel_permutation.hpp"
+#include "rng/normal_kernel.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+constexpr uint64_t MAX_KERNEL_RANGE = static_cast<uint64_t>(1) << 32;
+
+template <typename T>
+constexpr bool is_128_bit = std::is_same_v<T, hugeint_t> || std::is_same_v<T, uhugeint_t>;
+
+template <typename T>
+LogicalType integer_type() {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        return LogicalType::TINYINT;
+    } else if constexpr (std::is_same_v<T, int16_t>) {
+        return LogicalType::SMALLINT;
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return LogicalType::INTEGER;
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return LogicalType::BIGINT;
+    } else if constexpr (std::is_same_v<T, hugeint_t>) {
+        return LogicalType::HUGEINT;
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+        return LogicalType::UTINYINT;
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+        return LogicalType::USMALLINT;
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return LogicalType::UINTEGER;
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return LogicalType::UBIGINT;
+    } else {
+        static_assert(std::is_same_v<T, uhugeint_t>);
+        return LogicalType::UHUGEINT;
+    }
+}
+
+// Two's complement view of 128-bit integers.
+// The arithmetic operators of hugeint_t/uhugeint_t throw on overflow, but offsets have to wrap around.
+struct Uint128 {
+    uint64_t upper;
+    uint64_t lower;
+};
+
+template <typename T>
+Uint128 to_uint128(const T value) {
+    return {static_cast<uint64_t>(value.upper), value.lower};
+}
+
+template <typename T>
+T from_uint128(const Uint128 value) {
+    T result;
+    result.upper = static_cast<decltype(result.upper)>(value.upper);
+    result.lower = value.lower;
+    return result;
+}
+
+Uint128 add(const Uint128 a, const Uint128 b) {
+    const uint64_t lower = a.lower + b.lower;
+    const uint64_t carry = lower < a.lower;
+    return {a.upper + b.upper + carry, lower};
+}
+
+Uint128 subtract(const Uint128 a, const Uint128 b) {
+    const uint64_t borrow = a.lower < b.lower;
+    return {a.upper - b.upper - borrow, a.lower - b.lower};
+}
+
+bool less_or_equal(const Uint128 a, const Uint128 b) {
+    return a.upper < b.upper || (a.upper == b.upper && a.lower <= b.lower);
+}
+
+// Returns max - min as an unsigned 128-bit number
+template <typename T>
+Uint128 span(const T min, const T max) {
+    if constexpr (is_128_bit<T>) {
+        return subtract(to_uint128(max), to_uint128(min));
+    } else {
+        using U = std::make_unsigned_t<T>;
+        return {0, static_cast<U>(static_cast<U>(max) - static_cast<U>(min))};
+    }
+}
+
+// Rounds value to the nearest T, saturating at the limits of T
+template <typename T>
+T round_saturating(const double value) {
+    const double rounded = std::round(value);
+    if (rounded <= Cast::Operation<T, double>(NumericLimits<T>::Minimum())) {
+        return NumericLimits<T>::Minimum();
+    }
+    if (rounded >= Cast::Operation<T, double>(NumericLimits<T>::Maximum())) {
+        return NumericLimits<T>::Maximum();
+    }
+    return Cast::Operation<double, T>(rounded);
+}
+} // namespace
+
+template <typename T>
+IntColumnGenerator<T>::IntColumnGenerator(const uint64_t seed, const idx_t column_idx, const T min, const T max,
+                                          const ProbabilityDistribution::Type distribution,
+                                          const DistributionParameters parameters)
+    : IntColumnGenerator(integer_type<T>(), seed, column_idx, min, max, distribution, parameters) {
+}
+
+template <typename T>
+IntColumnGenerator<T>::IntColumnGenerator(const LogicalType& type, const uint64_t seed, const idx_t column_idx,
+                                          const T min, const T max, const ProbabilityDistribution::Type distribution,
+                                          const DistributionParameters parameters)
+    : ColumnGenerator(type), rng(seed, column_idx), min(min), max(max), distribution(distribution),
+      parameters(parameters) {
+    D_ASSERT(type.InternalType() == duckdb::GetTypeId<T>());
+    D_ASSERT(min <= max);
+    const Uint128 value_span = span(min, max);
+    if (value_span.upper == 0) {
+        // Wraps around to 0 for 2^64 values
+        range = value_span.lower + 1;
+    }
+
+    if (min == max) {
+        constant_value = min;
+    } else if (distribution == ProbabilityDistribution::Type::NORMAL && parameters.stddev == 0) {
+        constant_value = RoundAndClamp(parameters.mean);
+    } else if (distribution == ProbabilityDistribution::Type::ZIPF) {
+        if (!range.has_value()) {
+            throw InvalidInputException("The zipf distribution supports at most 2^64 values");
+        }
+        // The sampler counts ranks in uint64_t, so the last of 2^64 values is never drawn
+        const uint64_t num_elements = range.value() != 0 ? range.value() : UINT64_MAX;
+        zipf_sampler.emplace(num_elements, parameters.skew);
+    }
+}
+
+template <typename T>
+unique_ptr<IntColumnGenerator<T>> IntColumnGenerator<T>::Unique(const LogicalType& type, const uint64_t seed,
+                                                                const idx_t column_idx, const T min,
+                                                                const uint64_t domain_size) {
+    auto generator =
+        make_uniq<IntColumnGenerator<T>>(type, seed, column_idx, min, min, ProbabilityDistribution::Type::UNIFORM);
+    if (domain_size == 1) {
+        // The constant min is the only value
+        return generator;
+    }
+    // Wraps around to the offset 2^64 - 1 for a domain of 2^64 values
+    generator->max = generator->AddOffset(domain_size - 1);
+    generator->range = domain_size;
+    generator->constant_value.reset();
+    generator->permutation.emplace(domain_size, generator->rng.Word(0));
+    return generator;
+}
+
+template <typename T>
+void IntColumnGenerator<T>::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().InternalType() == duckdb::GetTypeId<T>());
+    if (constant_value.has_value()) {
+        result.Reference(ToValue(constant_value.value()));
+        return;
+    }
+
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    T* data = FlatVector::GetData<T>(result);
+    if (permutation.has_value()) {
+        GenerateUnique(rowids, count, data);
+        return;
+    }
+    if (histogram.has_value()) {
+        GenerateHistogram(rowids, count, data);
+        return;
+    }
+    switch (distribution) {
+    case ProbabilityDistribution::Type::UNIFORM:
+        if (range.has_value()) {
+            GenerateUniform(rowids, count, data);
+        } else {
+            GenerateUniformWide(rowids, count, data);
+        }
+        break;
+    case ProbabilityDistribution::Type::NORMAL:
+        GenerateNormal(rowids, count, data);
+        break;
+    case ProbabilityDistribution::Type::ZIPF:
+        GenerateZipf(rowids, count, data);
+        break;
+    default:
+        throw InternalException("Unsupported probability distribution");
+    }
+}
+
+template <typename T>
+unique_ptr<IntColumnGenerator<T>> IntColumnGenerator<T>::FromHistogram(const LogicalType& type, const uint64_t seed,
+                                                                       const idx_t column_idx,
+                                                                       EquiDepthHistogram histogram) {
+    const T min = round_saturating<T>(histogram.Min());
+    const T max = round_saturating<T>(histogram.Max());
+    auto generator =
+        make_uniq<IntColumnGenerator<T>>(type, seed, column_idx, min, max, ProbabilityDistribution::Type::UNIFORM);
+    if (min != max) {
+        generator->histogram.emplace(std::move(histogram));
+    }
+    return generator;
+}
+
+template <typename T>
+BaseStatistics IntColumnGenerator<T>::GetStatistics() const {
+    if (constant_value.has_value()) {
+        return BaseStatistics::FromConstant(ToValue(constant_value.value()));
+    }
+    // Every distribution stays within [min, max]
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    NumericStats::SetMin(stats, ToValue(min));
+    NumericStats::SetMax(stats, ToValue(max));
+    if (range.has_value() && range.value() != 0) {
+        stats.SetDistinctCount(range.value());
+    }
+    return stats;
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateUniform(const uint64_t* rowids, const idx_t count, T* data) const {
+    const uint64_t value_range = range.value();
+    if (value_range != 0 && value_range <= MAX_KERNEL_RANGE) {
+        uint32_t offsets[STANDARD_VECTOR_SIZE];
+        UnbiasedBoundedUint32Batch(rng, rowids, count, value_range, 0, offsets);
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            data[row_idx] = AddOffset(offsets[row_idx]);
+        }
+        return;
+    }
+
+    // Ranges of more than 2^32 values only occur for 64-bit and 128-bit types
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+    const uint64_t threshold = value_range == 0 ? 0 : (0 - value_range) % value_range;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        uint64_t offset = BoundedUint64(words[row_idx], value_range);
+        if (words[row_idx] * value_range < threshold) {
+            RowStream stream = rng.Stream(rowids[row_idx]);
+            offset = UnbiasedBoundedUint64(stream, value_range);
+        }
+        data[row_idx] = AddOffset(offset);
+    }
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateUniformWide(const uint64_t* rowids, const idx_t count, T* data) const {
+    if constexpr (is_128_bit<T>) {
+        // Draw random 128-bit numbers below the next power of two and reject those beyond the span
+        const Uint128 max_offset = span(min, max);
+        const int leading_zeros = std::countl_zero(max_offset.upper);
+        const uint64_t upper_mask = UINT64_MAX >> leading_zeros;
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            RowStream stream = rng.Stream(rowids[row_idx]);
+            Uint128 offset;
+            do {
+                offset.upper = stream.Next() & upper_mask;
+                offset.lower = stream.Next();
+            } while (!less_or_equal(offset, max_offset));
+            data[row_idx] = from_uint128<T>(add(to_uint128(min), offset));
+        }
+    } else {
+        throw InternalException("Only 128-bit integers can have more than 2^64 values");
+    }
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateNormal(const uint64_t* rowids, const idx_t count, T* data) const {
+    double values[STANDARD_VECTOR_SIZE];
+    FillStandardNormal(rng, rowids, count, values);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx] = RoundAndClamp(parameters.mean + parameters.stddev * values[row_idx]);
+    }
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateZipf(const uint64_t* rowids, const idx_t count, T* data) const {
+    D_ASSERT(zipf_sampler.has_value());
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        uint64_t rank;
+        if (!zipf_sampler->TrySample(words[row_idx], rank)) {
+            // Redraw the rejected row from the further words of the row
+            RowStream stream = rng.Stream(rowids[row_idx]);
+            while (!zipf_sampler->TrySample(stream.Next(), rank)) {
+            }
+        }
+        // Rank 1 is the most frequent value
+        data[row_idx] = AddOffset(rank - 1);
+    }
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateUnique(const uint64_t* rowids, const idx_t count, T* data) const {
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        D_ASSERT(range.value() == 0 || rowids[row_idx] < range.value());
+        data[row_idx] = AddOffset(permutation->Permute(rowids[row_idx]));
+    }
+}
+
+template <typename T>
+void IntColumnGenerator<T>::GenerateHistogram(const uint64_t* rowids, const idx_t count, T* data) const {
+    uint64_t words[STANDARD_VECTOR_SIZE];
+    rng.FillWords(rowids, count, words);
+    double values[STANDARD_VECTOR_SIZE];
+    histogram->Sample(words, count, values);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx] = RoundAndClamp(values[row_idx]);
+    }
+}
+
+template <typename T>
+T IntColumnGenerator<T>::RoundAndClamp(const double value) const {
+    const double rounded = std::round(value);
+    // Compare as doubles first, since the bounds of wide types are not exactly representable
+    if (rounded <= Cast::Operation<T, double>(min)) {
+        return min;
+    }
+    if (rounded >= Cast::Operation<T, double>(max)) {
+        return max;
+    }
+    return Cast::Operation<double, T>(rounded);
+}
+
+template <typename T>
+T IntColumnGenerator<T>::AddOffset(const uint64_t offset) const {
+    if constexpr (is_128_bit<T>) {
+        return from_uint128<T>(add(to_uint128(min), {0, offset}));
+    } else {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<U>(static_cast<U>(min) + static_cast<U>(offset)));
+    }
+}
+
+template <typename T>
+Value IntColumnGenerator<T>::ToValue(const T value) const {
+    Value result = Value::CreateValue<T>(value);
+    result.Reinterpret(type);
+    return result;
+}
+
+template class IntColumnGenerator<int8_t>;
+template class IntColumnGenerator<int16_t>;
+template class IntColumnGenerator<int32_t>;
+template class IntColumnGenerator<int64_t>;
+template class IntColumnGenerator<hugeint_t>;
+template class IntColumnGenerator<uint8_t>;
+template class IntColumnGenerator<uint16_t>;
+template class IntColumnGenerator<uint32_t>;
+template class IntColumnGenerator<uint64_t>;
+template class IntColumnGenerator<uhugeint_t>;
+
+} // namespace duckdb_faker
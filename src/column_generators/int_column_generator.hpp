@@ -0,0 +1,85 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/hugeint.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/uhugeint.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "rng/feistel_permutation.hpp"
+#include "rng/zipf_sampler.hpp"
+#include "table_functions/probability_distributions.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+// Generates integers of the physical type T, which is any signed or unsigned integer type from
+// int8_t to hugeint_t/uhugeint_t. Values are written directly into the native vector buffer.
+template <typename T>
+class IntColumnGenerator final : public ColumnGenerator {
+public:
+    // Values of the normal distribution are rounded and clamped to [min, max].
+    // The Zipf distribution assigns the highest probability to min, followed by min + 1 and so on.
+    IntColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, T min, T max,
+                       ProbabilityDistribution::Type distribution, DistributionParameters parameters = {});
+    // Generates values of another logical type stored as T, for example DATE as days since the epoch
+    IntColumnGenerator(const duckdb::LogicalType& type, uint64_t seed, duckdb::idx_t column_idx, T min, T max,
+                       ProbabilityDistribution::Type distribution, DistributionParameters parameters = {});
+
+    // Creates a generator of unique values min + p(rowid), where p is a keyed permutation of [0, domain_size).
+    // Distinct rowids below domain_size get distinct values. The domain must fit into the type, 0 denotes 2^64.
+    static duckdb::unique_ptr<IntColumnGenerator> Unique(const duckdb::LogicalType& type, uint64_t seed,
+                                                         duckdb::idx_t column_idx, T min, uint64_t domain_size);
+    // Creates a generator of values that follow the histogram, rounded to the nearest integer
+    static duckdb::unique_ptr<IntColumnGenerator> FromHistogram(const duckdb::LogicalType& type, uint64_t seed,
+                                                                duckdb::idx_t column_idx,
+                                                                EquiDepthHistogram histogram);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    void GenerateUniform(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateUniformWide(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateNormal(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateZipf(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateUnique(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    void GenerateHistogram(const uint64_t* rowids, duckdb::idx_t count, T* data) const;
+    T RoundAndClamp(double value) const;
+    // Returns min + offset
+    T AddOffset(uint64_t offset) const;
+    // Returns value as a Value of the logical type of the column
+    duckdb::Value ToValue(T value) const;
+
+    CounterRng rng;
+    T min;
+    T max;
+    // Number of possible values if it fits into 64 bits, where 0 denotes 2^64.
+    // Only 128-bit types can have larger ranges.
+    std::optional<uint64_t> range;
+    ProbabilityDistribution::Type distribution;
+    DistributionParameters parameters;
+    std::optional<ZipfSampler> zipf_sampler;
+    // Only set for generators of unique values
+    std::optional<FeistelPermutation> permutation;
+    // Only set for generators that follow a histogram
+    std::optional<EquiDepthHistogram> histogram;
+    // If min and max are equal or the standard deviation is 0, we can return a constant value
+    std::optional<T> constant_value;
+};
+
+extern template class IntColumnGenerator<int8_t>;
+extern template class IntColumnGenerator<int16_t>;
+extern template class IntColumnGenerator<int32_t>;
+extern template class IntColumnGenerator<int64_t>;
+extern template class IntColumnGenerator<duckdb::hugeint_t>;
+extern template class IntColumnGenerator<uint8_t>;
+extern template class IntColumnGenerator<uint16_t>;
+extern template class IntColumnGenerator<uint32_t>;
+extern template class IntColumnGenerator<uint64_t>;
+extern template class IntColumnGenerator<duckdb::uhugeint_t>;
+
+} // namespace duckdb_faker
@@ -0,0 +1,74 @@
+#include "interval_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "table_functions/probability_distributions.hpp"
+
+#include <cstdint>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separate the random words of the components, which would be identical for equal ranges otherwise
+constexpr uint64_t DAYS_SEED_KEY = 0xBB67AE8584CAA73BULL;
+constexpr uint64_t MICROS_SEED_KEY = 0x3C6EF372FE94F82BULL;
+} // namespace
+
+IntervalColumnGenerator::IntervalColumnGenerator(const uint64_t seed, const idx_t column_idx, const interval_t min,
+                                                 const interval_t max)
+    : ColumnGenerator(LogicalType::INTERVAL),
+      months_generator(seed, column_idx, min.months, max.months, ProbabilityDistribution::Type::UNIFORM),
+      days_generator(seed ^ DAYS_SEED_KEY, column_idx, min.days, max.days, ProbabilityDistribution::Type::UNIFORM),
+      micros_generator(
+          seed ^ MICROS_SEED_KEY, column_idx, min.micros, max.micros, ProbabilityDistribution::Type::UNIFORM) {
+    D_ASSERT(min.months <= max.months && min.days <= max.days && min.micros <= max.micros);
+    if (min.months == max.months && min.days == max.days && min.micros == max.micros) {
+        constant_value = min;
+    }
+}
+
+void IntervalColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().id() == LogicalTypeId::INTERVAL);
+    if (constant_value.has_value()) {
+        result.Reference(Value::INTERVAL(constant_value.value()));
+        return;
+    }
+
+    Vector months(LogicalType::INTEGER, count);
+    Vector days(LogicalType::INTEGER, count);
+    Vector micros(LogicalType::BIGINT, count);
+    months_generator.Generate(rowids, count, months);
+    days_generator.Generate(rowids, count, days);
+    micros_generator.Generate(rowids, count, micros);
+    // Components with a single possible value are returned as constant vectors
+    months.Flatten(count);
+    days.Flatten(count);
+    micros.Flatten(count);
+
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    const auto months_data = FlatVector::GetData<int32_t>(months);
+    const auto days_data = FlatVector::GetData<int32_t>(days);
+    const auto micros_data = FlatVector::GetData<int64_t>(micros);
+    auto* data = FlatVector::GetData<interval_t>(result);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx].months = months_data[row_idx];
+        data[row_idx].days = days_data[row_idx];
+        data[row_idx].micros = micros_data[row_idx];
+    }
+}
+
+BaseStatistics IntervalColumnGenerator::GetStatistics() const {
+    if (constant_value.has_value()) {
+        return BaseStatistics::FromConstant(Value::INTERVAL(constant_value.value()));
+    }
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    return stats;
+}
+
+} // namespace duckdb_faker
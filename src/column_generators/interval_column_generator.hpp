@@ -0,0 +1,30 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "int_column_generator.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+// Generates intervals whose months, days and microseconds are drawn independently from the corresponding
+// components of [min, max]. Intervals have no total order, so the bounds apply per component.
+class IntervalColumnGenerator final : public ColumnGenerator {
+public:
+    IntervalColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, duckdb::interval_t min, duckdb::interval_t max);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    // DuckDB keeps no bounds for intervals, so the statistics only tell that there are no NULLs
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    IntColumnGenerator<int32_t> months_generator;
+    IntColumnGenerator<int32_t> days_generator;
+    IntColumnGenerator<int64_t> micros_generator;
+    // If min and max are equal, we can return a constant value
+    std::optional<duckdb::interval_t> constant_value;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,202 @@
+#include "list_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/array_stats.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/list_stats.hpp"
+#include "rng/bounded_int_kernel.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the first child rows of the elements from the lengths, which use the same seed and column
+constexpr uint64_t ELEMENT_SEED_KEY = 0x1F83D9ABFB41BD6BULL;
+
+// Child generators of these types write their values into the vector they are given,
+// so they can fill a slice of the child vector instead of a separate batch
+bool can_generate_in_place(const LogicalType& type) {
+    switch (type.InternalType()) {
+    case PhysicalType::STRUCT:
+    case PhysicalType::LIST:
+    case PhysicalType::ARRAY:
+        return false;
+    default:
+        return true;
+    }
+}
+} // namespace
+
+ListColumnGenerator::ListColumnGenerator(const LogicalType& type, const uint64_t seed, const idx_t column_idx,
+                                         const uint32_t min_length, const uint32_t max_length,
+                                         unique_ptr<ColumnGenerator> child)
+    : ColumnGenerator(type), rng(seed, column_idx), element_rng(seed ^ ELEMENT_SEED_KEY, column_idx),
+      min_length(min_length), max_length(max_length), child(std::move(child)) {
+    D_ASSERT(type.id() == LogicalTypeId::LIST || type.id() == LogicalTypeId::ARRAY ||
+             type.id() == LogicalTypeId::MAP);
+    if (type.id() == LogicalTypeId::ARRAY) {
+        this->min_length = static_cast<uint32_t>(ArrayType::GetSize(type));
+        this->max_length = this->min_length;
+    }
+    D_ASSERT(this->min_length <= this->max_length);
+}
+
+void ListColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    uint32_t lengths[STANDARD_VECTOR_SIZE];
+    GenerateLengths(rowids, count, lengths);
+
+    if (type.id() == LogicalTypeId::ARRAY) {
+        // The child vector of an array already has room for all elements
+        GenerateElements(rowids, count, lengths, ArrayVector::GetEntry(result));
+        return;
+    }
+
+    D_ASSERT(ListVector::GetListSize(result) == 0);
+    auto* entries = FlatVector::GetData<list_entry_t>(result);
+    idx_t total_length = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        entries[row_idx].offset = total_length;
+        entries[row_idx].length = lengths[row_idx];
+        total_length += lengths[row_idx];
+    }
+    ListVector::Reserve(result, total_length);
+    GenerateElements(rowids, count, lengths, ListVector::GetEntry(result));
+    ListVector::SetListSize(result, total_length);
+
+    if (type.id() == LogicalTypeId::MAP) {
+        RemoveDuplicateKeys(result, count);
+    }
+}
+
+BaseStatistics ListColumnGenerator::GetStatistics() const {
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    // Removing duplicate keys of a MAP only drops elements, so the statistics of the child still hold
+    auto child_stats = child->GetStatistics().ToUnique();
+    if (type.id() == LogicalTypeId::ARRAY) {
+        ArrayStats::SetChildStats(stats, std::move(child_stats));
+    } else {
+        ListStats::SetChildStats(stats, std::move(child_stats));
+    }
+    return stats;
+}
+
+void ListColumnGenerator::GenerateLengths(const uint64_t* rowids, const idx_t count, uint32_t* lengths) const {
+    if (min_length == max_length) {
+        std::fill_n(lengths, count, min_length);
+        return;
+    }
+
+    const uint64_t range = static_cast<uint64_t>(max_length) - min_length + 1;
+    UnbiasedBoundedUint32Batch(rng, rowids, count, range, min_length, lengths);
+}
+
+void ListColumnGenerator::GenerateElements(const uint64_t* rowids, const idx_t count, const uint32_t* lengths,
+                                           Vector& target) const {
+    const bool in_place = can_generate_in_place(child->type);
+    if (in_place && child->type.InternalType() == PhysicalType::VARCHAR) {
+        // Slices share the string heap of the target only if it exists before slicing
+        StringVector::GetStringBuffer(target);
+    }
+
+    uint64_t element_rowids[STANDARD_VECTOR_SIZE];
+    uint64_t first_element_rowids[STANDARD_VECTOR_SIZE];
+    element_rng.FillWords(rowids, count, first_element_rowids);
+    idx_t batch_size = 0;
+    idx_t target_offset = 0;
+    const auto flush = [&]() {
+        if (!in_place) {
+            Vector batch(child->type, batch_size);
+            child->Generate(element_rowids, batch_size, batch);
+            VectorOperations::Copy(batch, target, batch_size, 0, target_offset);
+        } else {
+            Vector slice(target, target_offset, target_offset + batch_size);
+            const data_ptr_t slice_data = slice.GetData();
+            child->Generate(element_rowids, batch_size, slice);
+            if (slice.GetVectorType() != VectorType::FLAT_VECTOR || slice.GetData() != slice_data) {
+                // The child emitted a constant or dictionary vector instead of writing into the slice
+                VectorOperations::Copy(slice, target, batch_size, 0, target_offset);
+            } else if (!FlatVector::Validity(slice).AllValid()) {
+                // The validity mask of a slice is not shared with the target
+                for (idx_t i = 0; i < batch_size; i++) {
+                    if (!FlatVector::Validity(slice).RowIsValid(i)) {
+                        FlatVector::SetNull(target, target_offset + i, true);
+                    }
+                }
+            }
+        }
+        target_offset += batch_size;
+        batch_size = 0;
+    };
+
+    // The first child rows of two rows are random, so their elements practically never overlap
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        for (uint32_t element_idx = 0; element_idx < lengths[row_idx]; element_idx++) {
+            element_rowids[batch_size++] = first_element_rowids[row_idx] + element_idx;
+            if (batch_size == STANDARD_VECTOR_SIZE) {
+                flush();
+            }
+        }
+    }
+    if (batch_size > 0) {
+        flush();
+    }
+}
+
+void ListColumnGenerator::RemoveDuplicateKeys(Vector& result, const idx_t count) const {
+    const idx_t total_length = ListVector::GetListSize(result);
+    if (total_length == 0) {
+        return;
+    }
+
+    // Keys are only compared if their hashes are equal, which is rare for distinct keys
+    auto& keys = MapVector::GetKeys(result);
+    Vector hashes(LogicalType::HASH, total_length);
+    VectorOperations::Hash(keys, hashes, total_length);
+    const auto* hash_data = FlatVector::GetData<hash_t>(hashes);
+    const auto is_same_key = [&](const idx_t lhs, const idx_t rhs) {
+        return hash_data[lhs] == hash_data[rhs] && Value::NotDistinctFrom(keys.GetValue(lhs), keys.GetValue(rhs));
+    };
+
+    auto* entries = FlatVector::GetData<list_entry_t>(result);
+    SelectionVector kept(total_length);
+    idx_t kept_count = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        const idx_t row_start = kept_count;
+        const idx_t end = entries[row_idx].offset + entries[row_idx].length;
+        for (idx_t element_idx = entries[row_idx].offset; element_idx < end; element_idx++) {
+            // Maps are short, so a linear search within the row is cheaper than a hash set
+            bool is_duplicate = false;
+            for (idx_t kept_idx = row_start; kept_idx < kept_count && !is_duplicate; kept_idx++) {
+                is_duplicate = is_same_key(kept.get_index(kept_idx), element_idx);
+            }
+            if (!is_duplicate) {
+                kept.set_index(kept_count++, element_idx);
+            }
+        }
+        entries[row_idx].offset = row_start;
+        entries[row_idx].length = kept_count - row_start;
+    }
+    if (kept_count == total_length) {
+        return;
+    }
+
+    Vector compacted(ListType::GetChildType(type), kept_count);
+    VectorOperations::Copy(ListVector::GetEntry(result), compacted, kept, kept_count, 0, 0);
+    ListVector::SetListSize(result, 0);
+    ListVector::Append(result, compacted, kept_count);
+}
+
+} // namespace duckdb_faker
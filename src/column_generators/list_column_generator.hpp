@@ -0,0 +1,41 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace duckdb_faker {
+
+// Generates LIST, ARRAY and MAP values. The lengths of a chunk are generated first, so the child vector is reserved
+// once, and the child generator fills the elements in batches.
+// Element j of row r is generated as the child row w(r) + j, where w(r) is a random word of row r.
+class ListColumnGenerator final : public ColumnGenerator {
+public:
+    static constexpr uint64_t MAX_LENGTH = std::numeric_limits<uint32_t>::max();
+
+    // Lengths of ARRAY values are given by the type, min_length and max_length are ignored for them.
+    // Rows of a MAP can be shorter than min_length, since entries with duplicate keys are removed.
+    ListColumnGenerator(const duckdb::LogicalType& type, uint64_t seed, duckdb::idx_t column_idx, uint32_t min_length,
+                        uint32_t max_length, duckdb::unique_ptr<ColumnGenerator> child);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    void GenerateLengths(const uint64_t* rowids, duckdb::idx_t count, uint32_t* lengths) const;
+    // Generates the elements of the given rows into target, starting at index 0
+    void GenerateElements(const uint64_t* rowids, duckdb::idx_t count, const uint32_t* lengths,
+                          duckdb::Vector& target) const;
+    void RemoveDuplicateKeys(duckdb::Vector& result, duckdb::idx_t count) const;
+
+    CounterRng rng;
+    CounterRng element_rng;
+    uint32_t min_length;
+    uint32_t max_length;
+    duckdb::unique_ptr<ColumnGenerator> child;
+};
+
+} // namespace duckdb_faker
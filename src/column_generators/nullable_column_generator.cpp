@@ -0,0 +1,221 @@
+#include "nullable_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/array_stats.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/struct_stats.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the NULL decisions from the values of the wrapped generator, which uses the same seed and column
+constexpr uint64_t NULL_SEED_KEY = 0x6A09E667F3BCC909ULL;
+constexpr idx_t BITS_PER_WORD = 64;
+
+// The children of NULL structs and arrays are NULL as well, so their statistics have to allow NULLs too
+void set_has_null(BaseStatistics& stats) {
+    stats.SetHasNull();
+    switch (stats.GetType().InternalType()) {
+    case PhysicalType::STRUCT:
+        for (idx_t child_idx = 0; child_idx < StructType::GetChildCount(stats.GetType()); child_idx++) {
+            set_has_null(StructStats::GetChildStats(stats, child_idx));
+        }
+        break;
+    case PhysicalType::ARRAY:
+        set_has_null(ArrayStats::GetChildStats(stats));
+        break;
+    default:
+        break;
+    }
+}
+
+bool is_valid_row(const uint64_t* valid_bits, const idx_t row_idx) {
+    return (valid_bits[row_idx / BITS_PER_WORD] >> (row_idx % BITS_PER_WORD)) & 1;
+}
+
+// Turns constant values and dictionaries that end with a NULL entry into a dictionary result whose NULL rows select
+// a NULL entry, so that the values are neither flattened nor copied. Returns false for other vectors.
+bool select_with_nulls(Vector& values, const uint64_t* valid_bits, const idx_t count, Vector& result) {
+    if (values.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        Vector dictionary(values.GetType(), 2);
+        VectorOperations::Copy(values, dictionary, 1, 0, 0);
+        FlatVector::SetNull(dictionary, 1, true);
+        SelectionVector sel(count);
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            sel.set_index(row_idx, is_valid_row(valid_bits, row_idx) ? 0 : 1);
+        }
+        result.Dictionary(dictionary, 2, sel, count);
+        return true;
+    }
+    if (values.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+        return false;
+    }
+    const auto dictionary_size = DictionaryVector::DictionarySize(values);
+    auto& child = DictionaryVector::Child(values);
+    if (!dictionary_size.IsValid() || dictionary_size.GetIndex() == 0 ||
+        child.GetVectorType() != VectorType::FLAT_VECTOR ||
+        FlatVector::Validity(child).RowIsValid(dictionary_size.GetIndex() - 1)) {
+        return false;
+    }
+    const idx_t null_idx = dictionary_size.GetIndex() - 1;
+    const auto& values_sel = DictionaryVector::SelVector(values);
+    SelectionVector sel(count);
+    idx_t valid_idx = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        sel.set_index(row_idx, is_valid_row(valid_bits, row_idx) ? values_sel.get_index(valid_idx++) : null_idx);
+    }
+    // Values may be the result itself, so the dictionary is referenced before the result is replaced
+    Vector dictionary(child);
+    result.Dictionary(dictionary, dictionary_size.GetIndex(), sel, count);
+    return true;
+}
+
+// Moves the first valid_count values of the flat result to the valid rows given by valid_bits and zeroes the NULL
+// rows, which makes NULL lists empty and NULL strings inlined
+void spread_values(const uint64_t* valid_bits, const idx_t count, idx_t valid_count, Vector& result) {
+    const idx_t width = GetTypeIdSize(result.GetType().InternalType());
+    const data_ptr_t data = FlatVector::GetData(result);
+    auto& validity = FlatVector::Validity(result);
+    // A value only moves to a later row, so going backwards never overwrites a value that has not been moved yet
+    for (idx_t row_idx = count; row_idx-- > 0;) {
+        if (is_valid_row(valid_bits, row_idx)) {
+            valid_count--;
+            memmove(data + row_idx * width, data + valid_count * width, width);
+            validity.Set(row_idx, validity.RowIsValid(valid_count));
+        } else {
+            memset(data + row_idx * width, 0, width);
+            validity.SetInvalid(row_idx);
+        }
+    }
+}
+} // namespace
+
+NullableColumnGenerator::NullableColumnGenerator(unique_ptr<ColumnGenerator> generator, const uint64_t seed,
+                                                 const idx_t column_idx, const double null_probability)
+    : ColumnGenerator(generator->type), generator(std::move(generator)), rng(seed ^ NULL_SEED_KEY, column_idx),
+      null_probability(null_probability) {
+    D_ASSERT(null_probability >= 0 && null_probability <= 1);
+    if (null_probability < 1) {
+        null_threshold = ProbabilityThreshold(null_probability);
+    }
+}
+
+idx_t NullableColumnGenerator::FillValidBits(const uint64_t* rowids, const idx_t count, uint64_t* valid_bits) const {
+    const idx_t num_words = (count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    std::fill_n(valid_bits, num_words, 0);
+    if (null_probability == 0.5) {
+        // Every random word decides about 64 consecutive rowids
+        uint64_t block = UINT64_MAX;
+        uint64_t word = 0;
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            const uint64_t rowid = rowids[row_idx];
+            if (rowid / BITS_PER_WORD != block) {
+                block = rowid / BITS_PER_WORD;
+                word = rng.Word(block);
+            }
+            const uint64_t is_valid = (word >> (rowid % BITS_PER_WORD)) & 1;
+            valid_bits[row_idx / BITS_PER_WORD] |= is_valid << (row_idx % BITS_PER_WORD);
+        }
+    } else {
+        uint64_t words[STANDARD_VECTOR_SIZE];
+        rng.FillWords(rowids, count, words);
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            const uint64_t is_valid = words[row_idx] >= null_threshold;
+            valid_bits[row_idx / BITS_PER_WORD] |= is_valid << (row_idx % BITS_PER_WORD);
+        }
+    }
+
+    idx_t valid_count = 0;
+    for (idx_t i = 0; i < num_words; i++) {
+        valid_count += static_cast<idx_t>(std::popcount(valid_bits[i]));
+    }
+    return valid_count;
+}
+
+void NullableColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    if (null_probability == 1) {
+        result.Reference(Value(type));
+        return;
+    }
+
+    uint64_t valid_bits[STANDARD_VECTOR_SIZE / BITS_PER_WORD + 1];
+    const idx_t valid_count = FillValidBits(rowids, count, valid_bits);
+    if (valid_count == count) {
+        generator->Generate(rowids, count, result);
+        return;
+    }
+    if (valid_count == 0) {
+        result.Reference(Value(type));
+        return;
+    }
+
+    uint64_t valid_rowids[STANDARD_VECTOR_SIZE];
+    idx_t valid_idx = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        valid_rowids[valid_idx] = rowids[row_idx];
+        valid_idx += is_valid_row(valid_bits, row_idx);
+    }
+
+    if (type.InternalType() != PhysicalType::STRUCT && type.InternalType() != PhysicalType::ARRAY) {
+        // Generate only the valid rows into the result, then spread them out to their positions. The values of
+        // list rows are entries into the child vector, so no elements are generated or copied for NULL lists.
+        generator->Generate(valid_rowids, valid_count, result);
+        if (select_with_nulls(result, valid_bits, count, result)) {
+            return;
+        }
+        result.Flatten(valid_count);
+        spread_values(valid_bits, count, valid_count, result);
+        return;
+    }
+
+    // The values of structs and arrays live in their child vectors, so flat ones are copied to their positions
+    Vector values(type, valid_count);
+    generator->Generate(valid_rowids, valid_count, values);
+    if (select_with_nulls(values, valid_bits, count, result)) {
+        return;
+    }
+    SelectionVector positions(count);
+    valid_idx = 0;
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        const bool is_valid = is_valid_row(valid_bits, row_idx);
+        // NULL rows copy an arbitrary value, which is masked out afterwards
+        positions.set_index(row_idx, is_valid ? valid_idx : 0);
+        valid_idx += is_valid;
+    }
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    VectorOperations::Copy(values, result, positions, count, 0, 0);
+    // NULL structs and arrays also need NULL children, which SetNull takes care of
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        if (!is_valid_row(valid_bits, row_idx)) {
+            FlatVector::SetNull(result, row_idx, true);
+        }
+    }
+}
+
+BaseStatistics NullableColumnGenerator::GetStatistics() const {
+    if (null_probability == 1) {
+        return BaseStatistics::FromConstant(Value(type));
+    }
+    auto stats = generator->GetStatistics();
+    if (null_probability > 0) {
+        set_has_null(stats);
+    }
+    return stats;
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Makes the values of another generator NULL with the given probability.
+// The validity mask is synthesized from random words, and values are only generated for the non-NULL rows.
+// Constant and dictionary values of the wrapped generator are passed on as dictionaries instead of being copied.
+class NullableColumnGenerator final : public ColumnGenerator {
+public:
+    NullableColumnGenerator(duckdb::unique_ptr<ColumnGenerator> generator, uint64_t seed, duckdb::idx_t column_idx,
+                            double null_probability);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+    double NullProbability() const {
+        return null_probability;
+    }
+
+private:
+    // Writes one validity bit per row to valid_bits and returns the number of valid rows
+    duckdb::idx_t FillValidBits(const uint64_t* rowids, duckdb::idx_t count, uint64_t* valid_bits) const;
+
+    duckdb::unique_ptr<ColumnGenerator> generator;
+    CounterRng rng;
+    double null_probability;
+    // A uniform 64-bit word below this threshold yields NULL
+    uint64_t null_threshold = 0;
+};
+
+} // namespace duckdb_faker
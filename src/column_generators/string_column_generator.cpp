@@ -0,0 +1,236 @@
+#include "string_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "rng/bounded_int_kernel.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+std::string_view get_alphabet(const StringCasing casing) {
+    switch (casing) {
+    case StringCasing::Lower:
+        return "abcdefghijklmnopqrstuvwxyz";
+    case StringCasing::Upper:
+        return "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    case StringCasing::Mixed:
+        return "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    }
+    // Should never happen
+    throw InternalException("Invalid string casing");
+}
+
+char random_character(const uint64_t word, const unsigned lane, const std::string_view alphabet) {
+    // Every random word provides four characters from its 16-bit lanes
+    const uint64_t random_bits = (word >> (16 * lane)) & 0xFFFF;
+    return alphabet[(random_bits * alphabet.size()) >> 16];
+}
+
+void fill_characters(RowStream& stream, char* data, const uint64_t length, const std::string_view alphabet) {
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const uint64_t word = stream.Next();
+        data[i] = random_character(word, 0, alphabet);
+        data[i + 1] = random_character(word, 1, alphabet);
+        data[i + 2] = random_character(word, 2, alphabet);
+        data[i + 3] = random_character(word, 3, alphabet);
+    }
+    if (i < length) {
+        const uint64_t word = stream.Next();
+        for (unsigned lane = 0; i < length; i++, lane++) {
+            data[i] = random_character(word, lane, alphabet);
+        }
+    }
+}
+} // namespace
+
+StringColumnGenerator::StringColumnGenerator(const uint64_t seed, const idx_t column_idx, const uint64_t min_length,
+                                             const uint64_t max_length, const StringCasing casing,
+                                             const std::optional<uint64_t> distinct)
+    : ColumnGenerator(LogicalType::VARCHAR), rng(seed, column_idx), selection_rng(CounterRng::Mix(seed), column_idx),
+      min_length(min_length), max_length(max_length), casing(casing), pool_size(distinct.value_or(0)) {
+    D_ASSERT(min_length <= max_length);
+    D_ASSERT(max_length <= MAX_LENGTH);
+    D_ASSERT(pool_size <= MAX_DISTINCT);
+    if (max_length == 0) {
+        // Only the empty string is possible
+        constant_value = Value("");
+    } else if (distinct.has_value()) {
+        D_ASSERT(pool_size > 0);
+        BuildPool();
+        if (pool_size == 1) {
+            constant_value = pool->GetValue(0);
+        }
+    }
+}
+
+unique_ptr<StringColumnGenerator> StringColumnGenerator::FromHistogram(const uint64_t seed, const idx_t column_idx,
+                                                                       EquiDepthHistogram length_histogram) {
+    // Rounding the lengths keeps them within the rounded bounds
+    const auto min_length = static_cast<uint64_t>(std::round(length_histogram.Min()));
+    const auto max_length = static_cast<uint64_t>(std::round(length_histogram.Max()));
+    auto generator = make_uniq<StringColumnGenerator>(seed, column_idx, min_length, max_length, StringCasing::Lower);
+    generator->length_histogram.emplace(std::move(length_histogram));
+    return generator;
+}
+
+uint64_t StringColumnGenerator::NumPossibleStrings(const uint64_t min_length, const uint64_t max_length,
+                                                  const StringCasing casing) {
+    const uint64_t alphabet_size = get_alphabet(casing).size();
+    const auto saturating_multiply = [alphabet_size](const uint64_t value) {
+        return value > UINT64_MAX / alphabet_size ? UINT64_MAX : value * alphabet_size;
+    };
+    // Number of strings of the current length, which grows exponentially and saturates after a few lengths
+    uint64_t strings_of_length = 1;
+    for (uint64_t length = 0; length < min_length && strings_of_length != UINT64_MAX; length++) {
+        strings_of_length = saturating_multiply(strings_of_length);
+    }
+    uint64_t total = 0;
+    for (uint64_t length = min_length; length <= max_length && total != UINT64_MAX; length++) {
+        total = total > UINT64_MAX - strings_of_length ? UINT64_MAX : total + strings_of_length;
+        strings_of_length = saturating_multiply(strings_of_length);
+    }
+    return total;
+}
+
+uint64_t StringColumnGenerator::DefaultMaxLength(const uint64_t min_length) {
+    /*
+     * For small values, we still want to have a big-enough range.
+     * For example, for minimum length 1, there should be strings generated
+     * also for length 20.
+     * For minimum length 100, the maximum length should still be in the same
+     * order of magnitude, for example 200.
+     */
+    if (min_length < 10) {
+        return 20;
+    } else if (min_length < UINT64_MAX / 2) {
+        return min_length * 2;
+    } else {
+        return UINT64_MAX;
+    }
+}
+
+void StringColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().id() == LogicalTypeId::VARCHAR);
+    if (constant_value.has_value()) {
+        result.Reference(constant_value.value());
+        return;
+    }
+
+    if (pool) {
+        // Select the pool entries in place, selection indexes are 32-bit
+        SelectionVector sel(count);
+        UnbiasedBoundedUint32Batch(selection_rng, rowids, count, pool_size, 0, sel.data());
+        result.Dictionary(*pool, pool_size + 1, sel, count);
+        return;
+    }
+
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    FillStrings(rowids, count, result, FlatVector::GetData<string_t>(result));
+}
+
+BaseStatistics StringColumnGenerator::GetStatistics() const {
+    if (constant_value.has_value()) {
+        return BaseStatistics::FromConstant(constant_value.value());
+    }
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    // Statistics only keep a prefix of min and max, so repeating the smallest and largest character bounds all values
+    const auto alphabet = get_alphabet(casing);
+    const std::string min_string(MinValue<uint64_t>(min_length, StringStatsData::MAX_STRING_MINMAX_SIZE),
+                                 *std::min_element(alphabet.begin(), alphabet.end()));
+    const std::string max_string(MinValue<uint64_t>(max_length, StringStatsData::MAX_STRING_MINMAX_SIZE),
+                                 *std::max_element(alphabet.begin(), alphabet.end()));
+    StringStats::Update(stats, string_t(min_string.data(), static_cast<uint32_t>(min_string.size())));
+    StringStats::Update(stats, string_t(max_string.data(), static_cast<uint32_t>(max_string.size())));
+    StringStats::SetMaxStringLength(stats, static_cast<uint32_t>(max_length));
+    if (pool) {
+        stats.SetDistinctCount(pool_size);
+    }
+    return stats;
+}
+
+void StringColumnGenerator::FillStrings(const uint64_t* counters, const idx_t count, Vector& target,
+                                        string_t* out) const {
+    const auto alphabet = get_alphabet(casing);
+    // Determine the lengths of all strings of the chunk first
+    uint64_t lengths[STANDARD_VECTOR_SIZE];
+    rng.FillWords(counters, count, lengths);
+    if (length_histogram.has_value()) {
+        double sampled_lengths[STANDARD_VECTOR_SIZE];
+        length_histogram->Sample(lengths, count, sampled_lengths);
+        for (idx_t i = 0; i < count; i++) {
+            lengths[i] = static_cast<uint64_t>(std::round(sampled_lengths[i]));
+        }
+    } else {
+        // A range of 0 means that all 2^64 values are possible
+        const uint64_t length_range = max_length - min_length + 1;
+        for (idx_t i = 0; i < count; i++) {
+            lengths[i] = min_length + BoundedUint64(lengths[i], length_range);
+        }
+    }
+
+    // Write the characters directly into the inlined string or the string heap of the target vector
+    for (idx_t i = 0; i < count; i++) {
+        const auto length = static_cast<uint32_t>(lengths[i]);
+        RowStream stream = rng.Stream(counters[i]);
+        if (length <= string_t::INLINE_LENGTH) {
+            char buffer[string_t::INLINE_LENGTH];
+            fill_characters(stream, buffer, length, alphabet);
+            out[i] = string_t(buffer, length);
+        } else {
+            out[i] = StringVector::EmptyString(target, length);
+            fill_characters(stream, out[i].GetDataWriteable(), length, alphabet);
+            out[i].Finalize();
+        }
+    }
+}
+
+void StringColumnGenerator::BuildPool() {
+    // The pool ends with a NULL entry for NullableColumnGenerator
+    pool = make_uniq<Vector>(LogicalType::VARCHAR, pool_size + 1);
+    FlatVector::SetNull(*pool, pool_size, true);
+    auto pool_data = FlatVector::GetData<string_t>(*pool);
+    // The pool entries are generated like the rows of a table with pool_size rows
+    uint64_t counters[STANDARD_VECTOR_SIZE];
+    for (idx_t offset = 0; offset < pool_size; offset += STANDARD_VECTOR_SIZE) {
+        const idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, pool_size - offset);
+        for (idx_t i = 0; i < count; i++) {
+            counters[i] = offset + i;
+        }
+        FillStrings(counters, count, *pool, pool_data + offset);
+    }
+
+    // Duplicates are redrawn with the counters after the pool, so that the pool holds exactly pool_size strings
+    string_set_t pool_strings;
+    uint64_t next_counter = pool_size;
+    for (idx_t i = 0; i < pool_size; i++) {
+        while (!pool_strings.insert(pool_data[i]).second) {
+            FillStrings(&next_counter, 1, *pool, pool_data + i);
+            next_counter++;
+        }
+    }
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/equi_depth_histogram.hpp"
+#include "table_functions/string_casing.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace duckdb_faker {
+
+class StringColumnGenerator final : public ColumnGenerator {
+public:
+    // If distinct is given, the rows select from a pool of that many different strings, which is built once
+    StringColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, uint64_t min_length, uint64_t max_length,
+                          StringCasing casing, std::optional<uint64_t> distinct = std::nullopt);
+
+    // Creates a generator of lowercase strings whose lengths follow the histogram
+    static duckdb::unique_ptr<StringColumnGenerator> FromHistogram(uint64_t seed, duckdb::idx_t column_idx,
+                                                                   EquiDepthHistogram length_histogram);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+    // Longest string that can be stored in a string_t
+    static constexpr uint64_t MAX_LENGTH = std::numeric_limits<uint32_t>::max();
+    // The pool is built at bind time, so its number of strings and their total length are limited
+    static constexpr uint64_t MAX_DISTINCT = static_cast<uint64_t>(1) << 20;
+    static constexpr uint64_t MAX_POOL_LENGTH = static_cast<uint64_t>(1) << 30;
+
+    // Returns the number of strings with a length in [min_length, max_length], saturating at UINT64_MAX
+    static uint64_t NumPossibleStrings(uint64_t min_length, uint64_t max_length, StringCasing casing);
+    // Derives the maximum length from the minimum length if only the latter is given
+    static uint64_t DefaultMaxLength(uint64_t min_length);
+
+private:
+    // Writes the strings for the given counters to out, allocating long strings in the heap of target
+    void FillStrings(const uint64_t* counters, duckdb::idx_t count, duckdb::Vector& target,
+                     duckdb::string_t* out) const;
+    void BuildPool();
+
+    CounterRng rng;
+    CounterRng selection_rng;
+    uint64_t min_length;
+    uint64_t max_length;
+    StringCasing casing;
+    uint64_t pool_size;
+    // If set, the lengths follow this histogram instead of being uniform in [min_length, max_length]
+    std::optional<EquiDepthHistogram> length_histogram;
+    // Only read during generation, so it can be shared by all threads
+    duckdb::unique_ptr<duckdb::Vector> pool;
+    std::optional<duckdb::Value> constant_value;
+};
+
+} // namespace duckdb_faker
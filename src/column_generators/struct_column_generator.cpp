@@ -0,0 +1,41 @@
+#include "struct_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/struct_stats.hpp"
+
+#include <cstdint>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+StructColumnGenerator::StructColumnGenerator(const LogicalType& type, vector<unique_ptr<ColumnGenerator>> fields)
+    : ColumnGenerator(type), fields(std::move(fields)) {
+    D_ASSERT(type.id() == LogicalTypeId::STRUCT);
+    D_ASSERT(this->fields.size() == StructType::GetChildCount(type));
+}
+
+void StructColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    auto& entries = StructVector::GetEntries(result);
+    for (idx_t field_idx = 0; field_idx < fields.size(); field_idx++) {
+        fields[field_idx]->Generate(rowids, count, *entries[field_idx]);
+        // The children of a flat struct have to be flat as well
+        entries[field_idx]->Flatten(count);
+    }
+}
+
+BaseStatistics StructColumnGenerator::GetStatistics() const {
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    for (idx_t field_idx = 0; field_idx < fields.size(); field_idx++) {
+        StructStats::SetChildStats(stats, field_idx, fields[field_idx]->GetStatistics());
+    }
+    return stats;
+}
+
+} // namespace duckdb_faker
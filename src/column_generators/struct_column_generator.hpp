@@ -0,0 +1,23 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Generates STRUCT values by letting one generator per field fill the child vectors
+class StructColumnGenerator final : public ColumnGenerator {
+public:
+    StructColumnGenerator(const duckdb::LogicalType& type, duckdb::vector<duckdb::unique_ptr<ColumnGenerator>> fields);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+private:
+    duckdb::vector<duckdb::unique_ptr<ColumnGenerator>> fields;
+};
+
+} // namespace duckdb_faker
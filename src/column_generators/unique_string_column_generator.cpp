@@ -0,0 +1,83 @@
+#include "unique_string_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+constexpr uint64_t ALPHABET_SIZE = 26;
+
+void write_base26(uint64_t value, char* out, const uint32_t length) {
+    for (uint32_t i = length; i > 0; i--) {
+        out[i - 1] = static_cast<char>('a' + value % ALPHABET_SIZE);
+        value /= ALPHABET_SIZE;
+    }
+}
+} // namespace
+
+UniqueStringColumnGenerator::UniqueStringColumnGenerator(const uint64_t seed, const idx_t column_idx,
+                                                         const uint32_t length)
+    : ColumnGenerator(LogicalType::VARCHAR), length(length),
+      permutation(DomainSize(length), CounterRng(seed, column_idx).Word(0)) {
+    D_ASSERT(length >= 1 && length <= MAX_LENGTH);
+}
+
+void UniqueStringColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    auto* data = FlatVector::GetData<string_t>(result);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        const uint64_t value = permutation.Permute(rowids[row_idx]);
+        if (length <= string_t::INLINE_LENGTH) {
+            char buffer[string_t::INLINE_LENGTH];
+            write_base26(value, buffer, length);
+            data[row_idx] = string_t(buffer, length);
+        } else {
+            data[row_idx] = StringVector::EmptyString(result, length);
+            write_base26(value, data[row_idx].GetDataWriteable(), length);
+            data[row_idx].Finalize();
+        }
+    }
+}
+
+BaseStatistics UniqueStringColumnGenerator::GetStatistics() const {
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    const auto prefix_length = MinValue<uint32_t>(length, StringStatsData::MAX_STRING_MINMAX_SIZE);
+    const std::string min_string(prefix_length, 'a');
+    const std::string max_string(prefix_length, 'z');
+    StringStats::Update(stats, string_t(min_string.data(), prefix_length));
+    StringStats::Update(stats, string_t(max_string.data(), prefix_length));
+    StringStats::SetMaxStringLength(stats, length);
+    stats.SetDistinctCount(DomainSize(length));
+    return stats;
+}
+
+uint32_t UniqueStringColumnGenerator::RequiredLength(const uint64_t num_rows) {
+    uint32_t length = 1;
+    while (length <= MAX_LENGTH && DomainSize(length) < num_rows) {
+        length++;
+    }
+    return length;
+}
+
+uint64_t UniqueStringColumnGenerator::DomainSize(const uint32_t length) {
+    uint64_t domain_size = 1;
+    for (uint32_t i = 0; i < length; i++) {
+        domain_size *= ALPHABET_SIZE;
+    }
+    return domain_size;
+}
+
+} // namespace duckdb_faker
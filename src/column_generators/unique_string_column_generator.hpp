@@ -0,0 +1,32 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "rng/feistel_permutation.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Generates unique lowercase strings by writing a keyed permutation of the rowid in base 26.
+// All strings have the smallest length that provides enough distinct values for the rows.
+class UniqueStringColumnGenerator final : public ColumnGenerator {
+public:
+    // 26^13 is the largest power of 26 below 2^63
+    static constexpr uint32_t MAX_LENGTH = 13;
+
+    UniqueStringColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, uint32_t length);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+    // Returns the length needed for num_rows unique strings, which is at most MAX_LENGTH + 1
+    static uint32_t RequiredLength(uint64_t num_rows);
+
+private:
+    static uint64_t DomainSize(uint32_t length);
+
+    uint32_t length;
+    FeistelPermutation permutation;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,123 @@
+#include "uuid_column_generator.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/hugeint.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/feistel_permutation.hpp"
+
+#include <cstdint>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// The version is stored in bits 12 to 15 of the upper half
+constexpr uint64_t VERSION_MASK = 0xF000ULL;
+// The variant 0b10 is stored in the two most significant bits of the lower half
+constexpr uint64_t VARIANT_MASK = 0x3FFFFFFFFFFFFFFFULL;
+constexpr uint64_t VARIANT_BITS = 0x8000000000000000ULL;
+// DuckDB flips the most significant bit of UUIDs, so that they compare like their string representation
+constexpr uint64_t UPPER_SIGN_BIT = 0x8000000000000000ULL;
+// Unique UUIDs store the 62 lowest bits of the permuted rowid in the lower half and the 2 highest in the upper half
+constexpr uint32_t UNIQUE_LOWER_BITS = 62;
+constexpr uint64_t UNIQUE_UPPER_MASK = 0x3ULL;
+
+// Version 7 UUIDs start with 48 bits of Unix milliseconds followed by 12 bits of sub-millisecond precision.
+// Both are derived from the rowid, which makes the UUIDs increase with the rowid, starting at 2020-01-01.
+constexpr uint64_t V7_START_MILLIS = 1577836800000ULL;
+constexpr uint32_t V7_SUB_MILLIS_BITS = 12;
+constexpr uint64_t V7_START = V7_START_MILLIS << V7_SUB_MILLIS_BITS;
+
+// Returns the upper half of a version 7 UUID with the given timestamp in units of 1/4096 milliseconds
+uint64_t version_7_upper(const uint64_t timestamp) {
+    constexpr uint64_t sub_millis_mask = (1ULL << V7_SUB_MILLIS_BITS) - 1;
+    return ((timestamp >> V7_SUB_MILLIS_BITS) << 16) | 0x7000ULL | (timestamp & sub_millis_mask);
+}
+
+// Returns the hugeint representation of the UUID with the given halves, setting its variant
+hugeint_t to_hugeint(const uint64_t upper, const uint64_t lower) {
+    hugeint_t result;
+    result.upper = static_cast<int64_t>(upper ^ UPPER_SIGN_BIT);
+    result.lower = (lower & VARIANT_MASK) | VARIANT_BITS;
+    return result;
+}
+} // namespace
+
+UuidColumnGenerator::UuidColumnGenerator(const uint64_t seed, const idx_t column_idx, const uint8_t version)
+    : ColumnGenerator(LogicalType::UUID), upper_rng(CounterRng::Mix(seed), column_idx), lower_rng(seed, column_idx),
+      version(version) {
+    D_ASSERT(IsSupportedVersion(version));
+}
+
+void UuidColumnGenerator::Generate(const uint64_t* rowids, const idx_t count, Vector& result) const {
+    D_ASSERT(result.GetType().id() == LogicalTypeId::UUID);
+    D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+    uint64_t upper[STANDARD_VECTOR_SIZE];
+    uint64_t lower[STANDARD_VECTOR_SIZE];
+    if (version == 4) {
+        upper_rng.FillWords(rowids, count, upper);
+        if (permutation.has_value()) {
+            for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+                const uint64_t permuted = permutation->Permute(rowids[row_idx]);
+                // The variant overwrites the two highest bits of the lower half, so they go into the upper half
+                lower[row_idx] = permuted;
+                upper[row_idx] = (upper[row_idx] & ~UNIQUE_UPPER_MASK) | (permuted >> UNIQUE_LOWER_BITS);
+            }
+        } else {
+            lower_rng.FillWords(rowids, count, lower);
+        }
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            upper[row_idx] = (upper[row_idx] & ~VERSION_MASK) | 0x4000ULL;
+        }
+    } else {
+        lower_rng.FillWords(rowids, count, lower);
+        for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+            upper[row_idx] = version_7_upper(V7_START + rowids[row_idx]);
+        }
+    }
+
+    auto* data = FlatVector::GetData<hugeint_t>(result);
+    for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+        data[row_idx] = to_hugeint(upper[row_idx], lower[row_idx]);
+    }
+}
+
+BaseStatistics UuidColumnGenerator::GetStatistics() const {
+    auto stats = BaseStatistics::CreateEmpty(type);
+    stats.SetHasNoNull();
+    // The bounds only consider the bits that are fixed by the version and the variant
+    uint64_t min_upper = 0x4000ULL;
+    uint64_t max_upper = ~VERSION_MASK | 0x4000ULL;
+    if (version == 7) {
+        min_upper = version_7_upper(V7_START);
+        max_upper = version_7_upper(V7_START + MaxVersion7Rows() - 1);
+    }
+    NumericStats::SetMin(stats, Value::UUID(to_hugeint(min_upper, 0)));
+    NumericStats::SetMax(stats, Value::UUID(to_hugeint(max_upper, UINT64_MAX)));
+    return stats;
+}
+
+unique_ptr<UuidColumnGenerator> UuidColumnGenerator::Unique(const uint64_t seed, const idx_t column_idx) {
+    auto generator = make_uniq<UuidColumnGenerator>(seed, column_idx, 4);
+    // A domain of 2^64 covers all rowids
+    generator->permutation.emplace(0, generator->lower_rng.Word(0));
+    return generator;
+}
+
+bool UuidColumnGenerator::IsSupportedVersion(const int64_t version) {
+    return version == 4 || version == 7;
+}
+
+uint64_t UuidColumnGenerator::MaxVersion7Rows() {
+    constexpr uint32_t timestamp_bits = 48 + V7_SUB_MILLIS_BITS;
+    return (1ULL << timestamp_bits) - V7_START;
+}
+
+} // namespace duckdb_faker
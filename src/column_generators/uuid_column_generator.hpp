@@ -0,0 +1,39 @@
+#pragma once
+
+#include "column_generator.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "rng/counter_rng.hpp"
+#include "rng/feistel_permutation.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+// Generates UUIDs of version 4 (random) or version 7 (time-ordered).
+// The values are written as DuckDB's hugeint representation of UUIDs.
+class UuidColumnGenerator final : public ColumnGenerator {
+public:
+    UuidColumnGenerator(uint64_t seed, duckdb::idx_t column_idx, uint8_t version);
+
+    // Creates a generator of version 4 UUIDs whose random bits contain a keyed permutation of the rowid,
+    // so distinct rowids get distinct UUIDs
+    static duckdb::unique_ptr<UuidColumnGenerator> Unique(uint64_t seed, duckdb::idx_t column_idx);
+
+    void Generate(const uint64_t* rowids, duckdb::idx_t count, duckdb::Vector& result) const override;
+    duckdb::BaseStatistics GetStatistics() const override;
+
+    static bool IsSupportedVersion(int64_t version);
+    // Number of rows for which the 48-bit timestamp of version 7 UUIDs does not overflow
+    static uint64_t MaxVersion7Rows();
+
+private:
+    // Random bits of the upper and lower half of the UUID
+    CounterRng upper_rng;
+    CounterRng lower_rng;
+    uint8_t version;
+    // Only set for generators of unique values
+    std::optional<FeistelPermutation> permutation;
+};
+
+} // namespace duckdb_faker
@@ -4,19 +4,34 @@
 
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "table_functions/booleans.hpp"
+#include "table_functions/choices.hpp"
+#include "table_functions/limit_pushdown.hpp"
 #include "table_functions/numbers.hpp"
 #include "table_functions/random_data.hpp"
 #include "table_functions/strings.hpp"
+#include "table_functions/temporal.hpp"
+#include "table_functions/uuids.hpp"
 
 namespace duckdb {
 
 void FakerExtension::LoadInternal(ExtensionLoader& loader) {
     duckdb_faker::RandomBoolFunction::RegisterFunction(loader);
+    duckdb_faker::RandomChoiceFunction::RegisterFunction(loader);
+    duckdb_faker::RandomDateFunction::RegisterFunction(loader);
+    duckdb_faker::RandomDecimalFunction::RegisterFunction(loader);
+    duckdb_faker::RandomFloatFunction::RegisterFunction(loader);
     duckdb_faker::RandomIntFunction::RegisterFunction(loader);
+    duckdb_faker::RandomIntervalFunction::RegisterFunction(loader);
     duckdb_faker::RandomStringFunction::RegisterFunction(loader);
+    duckdb_faker::RandomTimeFunction::RegisterFunction(loader);
+    duckdb_faker::RandomTimestampFunction::RegisterFunction(loader);
+    duckdb_faker::RandomUuidFunction::RegisterFunction(loader);
 
     // Generates mixed types based on a source schema
     duckdb_faker::RandomDataFunction::RegisterFunction(loader);
+
+    // Lets generator scans start at the OFFSET instead of generating the skipped rows
+    duckdb_faker::RegisterLimitPushdown(loader);
 }
 
 void FakerExtension::Load(ExtensionLoader& loader) {
@@ -0,0 +1,70 @@
+#include "alias_table.hpp"
+
+#include "counter_rng.hpp"
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace duckdb_faker {
+
+namespace {
+// Maps a probability to a threshold on the 64-bit fraction within a slot.
+// Rounding errors while filling the slots can push the probability slightly below 0.
+uint64_t to_threshold(const double probability) {
+    if (probability <= 0.0) {
+        return 0;
+    }
+    if (probability >= 1.0) {
+        return UINT64_MAX;
+    }
+    return ProbabilityThreshold(probability);
+}
+} // namespace
+
+AliasTable::AliasTable(const std::vector<double>& weights) : thresholds(weights.size()), aliases(weights.size()) {
+    const uint64_t size = weights.size();
+    const double total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+    // Scale the probabilities such that the average slot is exactly full
+    std::vector<double> scaled(size);
+    std::vector<uint64_t> small;
+    std::vector<uint64_t> large;
+    for (uint64_t i = 0; i < size; i++) {
+        scaled[i] = weights[i] * static_cast<double>(size) / total_weight;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+        aliases[i] = i;
+    }
+
+    // Fill each underfull slot with the remaining probability of an overfull one
+    while (!small.empty() && !large.empty()) {
+        const uint64_t underfull = small.back();
+        small.pop_back();
+        const uint64_t overfull = large.back();
+
+        thresholds[underfull] = to_threshold(scaled[underfull]);
+        aliases[underfull] = overfull;
+        scaled[overfull] -= 1.0 - scaled[underfull];
+        if (scaled[overfull] < 1.0) {
+            large.pop_back();
+            small.push_back(overfull);
+        }
+    }
+    // The remaining slots are full up to rounding errors, so they always select themselves
+    for (const uint64_t i : small) {
+        aliases[i] = i;
+    }
+    for (const uint64_t i : large) {
+        aliases[i] = i;
+    }
+}
+
+uint64_t AliasTable::Sample(const uint64_t word) const {
+    const uint64_t size = Size();
+    const uint64_t slot = MulHi64(word, size);
+    // The lower half of the product is the uniformly distributed fraction within the slot
+    const uint64_t fraction = word * size;
+    return fraction < thresholds[slot] ? slot : aliases[slot];
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace duckdb_faker {
+
+// Samples indexes in [0, size) with probability proportional to the given weights in O(1) per sample
+// using Vose's alias method. Each table slot holds its own index and an alias, and a threshold that decides
+// between the two.
+class AliasTable {
+public:
+    // The weights have to be finite and non-negative, and at least one has to be positive
+    explicit AliasTable(const std::vector<double>& weights);
+
+    // Maps a random word to an index. The upper bits select the slot and the remaining fraction decides
+    // between the slot and its alias.
+    uint64_t Sample(uint64_t word) const;
+
+    uint64_t Size() const {
+        return thresholds.size();
+    }
+
+private:
+    std::vector<uint64_t> thresholds;
+    std::vector<uint64_t> aliases;
+};
+
+} // namespace duckdb_faker
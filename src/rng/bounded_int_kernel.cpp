@@ -0,0 +1,157 @@
+#include "bounded_int_kernel.hpp"
+
+#include "counter_rng.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FAKER_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace duckdb_faker {
+
+namespace {
+constexpr uint64_t FULL_RANGE = 1ULL << 32;
+// Number of rows whose words are kept on the stack at once, which matches the vector size of DuckDB
+constexpr uint64_t ROW_BATCH_SIZE = 2048;
+
+using BatchKernel = uint64_t (*)(const uint64_t* words, uint64_t count, uint64_t range, uint32_t base,
+                                 uint32_t* out, uint64_t* rejected);
+
+// Handles the words from start on one at a time
+uint64_t bounded_batch_scalar_from(const uint64_t start, const uint64_t* words, const uint64_t count,
+                                   const uint64_t range, const uint32_t base, uint32_t* out, uint64_t* rejected,
+                                   uint64_t num_rejected) {
+    const uint64_t threshold = (0 - range) % range;
+    for (uint64_t i = start; i < count; i++) {
+        out[i] = base + static_cast<uint32_t>(MulHi64(words[i], range));
+        if (words[i] * range < threshold) {
+            rejected[num_rejected++] = i;
+        }
+    }
+    return num_rejected;
+}
+
+uint64_t bounded_batch_scalar(const uint64_t* words, const uint64_t count, const uint64_t range, const uint32_t base,
+                              uint32_t* out, uint64_t* rejected) {
+    return bounded_batch_scalar_from(0, words, count, range, base, out, rejected, 0);
+}
+
+#ifdef FAKER_X86_KERNELS
+// Both kernels require range < 2^32, so that the product can be assembled from two 32x32-bit multiplications:
+// word * range = (word_hi * range) * 2^32 + word_lo * range
+
+__attribute__((target("avx2"))) uint64_t bounded_batch_avx2(const uint64_t* words, const uint64_t count,
+                                                            const uint64_t range, const uint32_t base, uint32_t* out,
+                                                            uint64_t* rejected) {
+    const uint64_t threshold = (0 - range) % range;
+    const __m256i range_vec = _mm256_set1_epi64x(static_cast<int64_t>(range));
+    const __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    // AVX2 only has signed 64-bit comparisons, so both sides are shifted by 2^63
+    const __m256i sign_bit = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i threshold_vec = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(threshold)), sign_bit);
+    const __m256i even_lanes = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const __m128i base_vec = _mm_set1_epi32(static_cast<int32_t>(base));
+
+    uint64_t num_rejected = 0;
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i word = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        const __m256i product_lo = _mm256_mul_epu32(word, range_vec);
+        const __m256i product_hi = _mm256_mul_epu32(_mm256_srli_epi64(word, 32), range_vec);
+        const __m256i middle = _mm256_add_epi64(product_hi, _mm256_srli_epi64(product_lo, 32));
+        const __m256i result = _mm256_srli_epi64(middle, 32);
+        const __m256i remainder =
+            _mm256_or_si256(_mm256_slli_epi64(middle, 32), _mm256_and_si256(product_lo, low_mask));
+
+        const __m128i packed = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(result, even_lanes));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(packed, base_vec));
+
+        const __m256i is_biased = _mm256_cmpgt_epi64(threshold_vec, _mm256_xor_si256(remainder, sign_bit));
+        auto biased_lanes = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(is_biased)));
+        while (biased_lanes != 0) {
+            rejected[num_rejected++] = i + static_cast<uint64_t>(__builtin_ctz(biased_lanes));
+            biased_lanes &= biased_lanes - 1;
+        }
+    }
+    return bounded_batch_scalar_from(i, words, count, range, base, out, rejected, num_rejected);
+}
+
+__attribute__((target("avx512f"))) uint64_t bounded_batch_avx512(const uint64_t* words, const uint64_t count,
+                                                                 const uint64_t range, const uint32_t base,
+                                                                 uint32_t* out, uint64_t* rejected) {
+    const uint64_t threshold = (0 - range) % range;
+    const __m512i range_vec = _mm512_set1_epi64(static_cast<int64_t>(range));
+    const __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFFLL);
+    const __m512i threshold_vec = _mm512_set1_epi64(static_cast<int64_t>(threshold));
+    const __m256i base_vec = _mm256_set1_epi32(static_cast<int32_t>(base));
+
+    uint64_t num_rejected = 0;
+    uint64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m512i word = _mm512_loadu_si512(words + i);
+        const __m512i product_lo = _mm512_mul_epu32(word, range_vec);
+        const __m512i product_hi = _mm512_mul_epu32(_mm512_srli_epi64(word, 32), range_vec);
+        const __m512i middle = _mm512_add_epi64(product_hi, _mm512_srli_epi64(product_lo, 32));
+        const __m512i result = _mm512_srli_epi64(middle, 32);
+        const __m512i remainder =
+            _mm512_or_si512(_mm512_slli_epi64(middle, 32), _mm512_and_si512(product_lo, low_mask));
+
+        const __m256i packed = _mm512_cvtepi64_epi32(result);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(packed, base_vec));
+
+        auto biased_lanes = static_cast<unsigned>(_mm512_cmplt_epu64_mask(remainder, threshold_vec));
+        while (biased_lanes != 0) {
+            rejected[num_rejected++] = i + static_cast<uint64_t>(__builtin_ctz(biased_lanes));
+            biased_lanes &= biased_lanes - 1;
+        }
+    }
+    return bounded_batch_scalar_from(i, words, count, range, base, out, rejected, num_rejected);
+}
+#endif
+
+BatchKernel select_kernel() {
+#ifdef FAKER_X86_KERNELS
+    if (__builtin_cpu_supports("avx512f")) {
+        return bounded_batch_avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return bounded_batch_avx2;
+    }
+#endif
+    return bounded_batch_scalar;
+}
+} // namespace
+
+uint64_t BoundedUint32Batch(const uint64_t* words, const uint64_t count, const uint64_t range, const uint32_t base,
+                            uint32_t* out, uint64_t* rejected) {
+    if (range == FULL_RANGE) {
+        // Every 32-bit value is possible, so the upper half of the word is already unbiased
+        for (uint64_t i = 0; i < count; i++) {
+            out[i] = base + static_cast<uint32_t>(words[i] >> 32);
+        }
+        return 0;
+    }
+    static const BatchKernel kernel = select_kernel();
+    return kernel(words, count, range, base, out, rejected);
+}
+
+void UnbiasedBoundedUint32Batch(const CounterRng& rng, const uint64_t* rowids, const uint64_t count,
+                                const uint64_t range, const uint32_t base, uint32_t* out) {
+    uint64_t words[ROW_BATCH_SIZE];
+    uint64_t rejected[ROW_BATCH_SIZE];
+    for (uint64_t start = 0; start < count; start += ROW_BATCH_SIZE) {
+        const uint64_t batch_count = std::min(ROW_BATCH_SIZE, count - start);
+        rng.FillWords(rowids + start, batch_count, words);
+        const uint64_t num_rejected = BoundedUint32Batch(words, batch_count, range, base, out + start, rejected);
+        for (uint64_t i = 0; i < num_rejected; i++) {
+            const uint64_t row_idx = start + rejected[i];
+            RowStream stream = rng.Stream(rowids[row_idx]);
+            out[row_idx] = base + static_cast<uint32_t>(UnbiasedBoundedUint64(stream, range));
+        }
+    }
+}
+
+} // namespace duckdb_faker
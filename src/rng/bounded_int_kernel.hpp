@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+class CounterRng;
+
+// Maps random words to base + [0, range) for 0 < range <= 2^32 using Lemire's multiply-shift method:
+// the result is the upper half of the 128-bit product word * range.
+// A result is slightly biased if the lower half of the product is smaller than 2^64 mod range. The indexes of
+// such words are written to rejected, so that the caller can redraw them, and their number is returned.
+// Additions wrap around modulo 2^32, so a signed minimum can be passed as its two's complement.
+// Uses AVX-512 or AVX2 if the CPU supports it.
+uint64_t BoundedUint32Batch(const uint64_t* words, uint64_t count, uint64_t range, uint32_t base, uint32_t* out,
+                            uint64_t* rejected);
+
+// Maps the words of the given rows to base + [0, range) without bias for 0 < range <= 2^32.
+// Runs BoundedUint32Batch on the row words and redraws the few biased rows from the streams of their rows.
+void UnbiasedBoundedUint32Batch(const CounterRng& rng, const uint64_t* rowids, uint64_t count, uint64_t range,
+                                uint32_t base, uint32_t* out);
+
+} // namespace duckdb_faker
@@ -0,0 +1,31 @@
+#include "counter_rng.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+namespace {
+// Separates the key of the per-row streams from the key of the row words
+constexpr uint64_t STREAM_KEY = 0xD1B54A32D192ED03ULL;
+} // namespace
+
+CounterRng::CounterRng(const uint64_t seed, const uint64_t column) : key(Mix(seed ^ Mix(column + 1))) {
+}
+
+void CounterRng::FillWords(const uint64_t start_counter, const uint64_t count, uint64_t* out) const {
+    for (uint64_t i = 0; i < count; i++) {
+        out[i] = Word(start_counter + i);
+    }
+}
+
+void CounterRng::FillWords(const uint64_t* counters, const uint64_t count, uint64_t* out) const {
+    for (uint64_t i = 0; i < count; i++) {
+        out[i] = Word(counters[i]);
+    }
+}
+
+RowStream CounterRng::Stream(const uint64_t counter) const {
+    return RowStream(Word(counter) ^ STREAM_KEY);
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Sequential SplitMix64 generator.
+// Used when a single row needs more random words than the one returned by CounterRng::Word,
+// for example for the characters of a string.
+class RowStream {
+public:
+    explicit RowStream(const uint64_t state) : state(state) {
+    }
+
+    uint64_t Next();
+
+private:
+    uint64_t state;
+};
+
+// Counter-based random number generator.
+// Every random word is a pure function of the key (derived from seed and column) and a counter,
+// which is usually the rowid. Hence, any row can be computed directly without generating the rows before it.
+// This makes the output independent of the order in which rows are generated.
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t column);
+
+    // Returns the random word for the given counter
+    uint64_t Word(uint64_t counter) const;
+    // Writes the random words for the counters [start_counter, start_counter + count) to out
+    void FillWords(uint64_t start_counter, uint64_t count, uint64_t* out) const;
+    // Writes the random words for the given counters to out
+    void FillWords(const uint64_t* counters, uint64_t count, uint64_t* out) const;
+    // Returns a stream of further random words for the given counter
+    RowStream Stream(uint64_t counter) const;
+
+    static uint64_t Mix(uint64_t value);
+
+private:
+    uint64_t key;
+};
+
+// Returns the upper 64 bits of the 128-bit product of a and b
+uint64_t MulHi64(uint64_t a, uint64_t b);
+// Maps a random word to a double in [0, 1) using its upper 53 bits
+double UniformDouble(uint64_t word);
+// Returns the threshold below which a random word lies with the given probability in [0, 1)
+uint64_t ProbabilityThreshold(double probability);
+// Maps a random word to an integer in [0, range) using a multiply-shift. A range of 0 denotes 2^64.
+uint64_t BoundedUint64(uint64_t word, uint64_t range);
+// Maps words of the stream to an integer in [0, range) without bias by rejecting words that would favor some values.
+// A range of 0 denotes 2^64.
+uint64_t UnbiasedBoundedUint64(RowStream& stream, uint64_t range);
+
+inline uint64_t CounterRng::Mix(uint64_t value) {
+    // Finalizer of SplitMix64
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+inline uint64_t CounterRng::Word(const uint64_t counter) const {
+    return Mix((counter * 0x9E3779B97F4A7C15ULL) ^ key);
+}
+
+inline uint64_t RowStream::Next() {
+    state += 0x9E3779B97F4A7C15ULL;
+    return CounterRng::Mix(state);
+}
+
+inline uint64_t MulHi64(const uint64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+    const uint64_t a_lo = a & 0xFFFFFFFFULL;
+    const uint64_t a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFULL;
+    const uint64_t b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+inline double UniformDouble(const uint64_t word) {
+    return static_cast<double>(word >> 11) * 0x1.0p-53;
+}
+
+inline uint64_t ProbabilityThreshold(const double probability) {
+    // p * 2^64 is below 2^64 for any double p < 1
+    return static_cast<uint64_t>(std::ldexp(probability, 64));
+}
+
+inline uint64_t BoundedUint64(const uint64_t word, const uint64_t range) {
+    if (range == 0) {
+        return word;
+    }
+    return MulHi64(word, range);
+}
+
+inline uint64_t UnbiasedBoundedUint64(RowStream& stream, const uint64_t range) {
+    if (range == 0) {
+        return stream.Next();
+    }
+    // 2^64 mod range
+    const uint64_t threshold = (0 - range) % range;
+    while (true) {
+        const uint64_t word = stream.Next();
+        if (word * range >= threshold) {
+            return MulHi64(word, range);
+        }
+    }
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,31 @@
+#include "equi_depth_histogram.hpp"
+
+#include "counter_rng.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace duckdb_faker {
+
+EquiDepthHistogram::EquiDepthHistogram(std::vector<double> boundaries) : boundaries(std::move(boundaries)) {
+}
+
+void EquiDepthHistogram::Sample(const uint64_t* words, const uint64_t count, double* out) const {
+    const uint64_t num_buckets = boundaries.size() - 1;
+    if (num_buckets == 0) {
+        std::fill_n(out, count, boundaries.front());
+        return;
+    }
+    const double* lower = boundaries.data();
+    for (uint64_t i = 0; i < count; i++) {
+        // The integer part selects the bucket and the fraction the position within it
+        const double position = UniformDouble(words[i]) * static_cast<double>(num_buckets);
+        const uint64_t bucket = std::min(static_cast<uint64_t>(position), num_buckets - 1);
+        const double fraction = position - static_cast<double>(bucket);
+        out[i] = lower[bucket] + (lower[bucket + 1] - lower[bucket]) * fraction;
+    }
+}
+
+} // namespace duckdb_faker
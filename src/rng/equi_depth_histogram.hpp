@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace duckdb_faker {
+
+// Histogram whose buckets all hold the same number of values, sampled by inverse-CDF lookup.
+// Since the buckets are equally likely, a random word selects its bucket directly without a search,
+// and the value is interpolated linearly between the boundaries of the bucket.
+class EquiDepthHistogram {
+public:
+    // The boundaries have to be sorted. n + 1 boundaries describe n buckets, a single boundary a constant.
+    explicit EquiDepthHistogram(std::vector<double> boundaries);
+
+    // Writes the values for the given random words to out
+    void Sample(const uint64_t* words, uint64_t count, double* out) const;
+
+    double Min() const {
+        return boundaries.front();
+    }
+    double Max() const {
+        return boundaries.back();
+    }
+
+private:
+    std::vector<double> boundaries;
+};
+
+} // namespace duckdb_faker
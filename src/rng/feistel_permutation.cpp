@@ -0,0 +1,40 @@
+#include "feistel_permutation.hpp"
+
+#include "counter_rng.hpp"
+
+#include <bit>
+#include <cstdint>
+
+namespace duckdb_faker {
+
+FeistelPermutation::FeistelPermutation(const uint64_t domain_size, const uint64_t key) : domain_size(domain_size) {
+    const uint32_t bits = domain_size == 0 ? 64 : static_cast<uint32_t>(std::bit_width(domain_size - 1));
+    half_bits = bits <= 2 ? 1 : (bits + 1) / 2;
+    half_mask = (static_cast<uint64_t>(1) << half_bits) - 1;
+    for (int round = 0; round < ROUNDS; round++) {
+        round_keys[round] = CounterRng::Mix(key + static_cast<uint64_t>(round) * 0x9E3779B97F4A7C15ULL);
+    }
+}
+
+uint64_t FeistelPermutation::Permute(const uint64_t index) const {
+    uint64_t value = Encrypt(index);
+    if (domain_size != 0) {
+        while (value >= domain_size) {
+            value = Encrypt(value);
+        }
+    }
+    return value;
+}
+
+uint64_t FeistelPermutation::Encrypt(const uint64_t value) const {
+    uint64_t left = value >> half_bits;
+    uint64_t right = value & half_mask;
+    for (const uint64_t round_key : round_keys) {
+        const uint64_t next_right = left ^ (CounterRng::Mix(right ^ round_key) & half_mask);
+        left = right;
+        right = next_right;
+    }
+    return (left << half_bits) | right;
+}
+
+} // namespace duckdb_faker
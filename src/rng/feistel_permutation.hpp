@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Keyed bijection of [0, domain_size), used to generate unique values from distinct rowids.
+// A balanced Feistel network permutes the smallest even number of bits covering the domain,
+// and cycle walking re-encrypts values beyond the domain until they fall into it.
+// The network covers at most four times the domain, so a few rounds of walking suffice on average.
+class FeistelPermutation {
+public:
+    // A domain_size of 0 denotes 2^64
+    FeistelPermutation(uint64_t domain_size, uint64_t key);
+
+    // Maps index, which must be in the domain, to its position in the permutation
+    uint64_t Permute(uint64_t index) const;
+
+private:
+    static constexpr int ROUNDS = 6;
+
+    uint64_t Encrypt(uint64_t value) const;
+
+    uint64_t domain_size;
+    uint32_t half_bits;
+    uint64_t half_mask;
+    uint64_t round_keys[ROUNDS];
+};
+
+} // namespace duckdb_faker
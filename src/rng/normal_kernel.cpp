@@ -0,0 +1,39 @@
+#include "normal_kernel.hpp"
+
+#include "counter_rng.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace duckdb_faker {
+
+namespace {
+constexpr double TWO_PI = 6.283185307179586476925286766559;
+constexpr double HALF_PI = 1.5707963267948966192313216916398;
+// Process the values in blocks, so that the buffers stay in the L1 cache
+constexpr uint64_t BLOCK_SIZE = 256;
+} // namespace
+
+void FillStandardNormal(const CounterRng& rng, const uint64_t* counters, const uint64_t count, double* out) {
+    uint64_t words[BLOCK_SIZE];
+    for (uint64_t block_start = 0; block_start < count; block_start += BLOCK_SIZE) {
+        const uint64_t block_count = std::min(BLOCK_SIZE, count - block_start);
+        const uint64_t* block_counters = counters + block_start;
+        for (uint64_t i = 0; i < block_count; i++) {
+            words[i] = rng.Word(block_counters[i] / 2);
+        }
+        // Branch-free, so that the compiler can vectorize the transform
+        for (uint64_t i = 0; i < block_count; i++) {
+            // The upper half is mapped to (0, 1] to keep the logarithm finite, the lower half to [0, 1)
+            const double u1 = static_cast<double>((words[i] >> 32) + 1) * 0x1.0p-32;
+            const double u2 = static_cast<double>(words[i] & 0xFFFFFFFFULL) * 0x1.0p-32;
+            const double radius = std::sqrt(-2.0 * std::log(u1));
+            // cos(x - pi/2) = sin(x) for the odd counter of the pair
+            const double angle = TWO_PI * u2 - HALF_PI * static_cast<double>(block_counters[i] & 1);
+            out[block_start + i] = radius * std::cos(angle);
+        }
+    }
+}
+
+} // namespace duckdb_faker
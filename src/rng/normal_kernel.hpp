@@ -0,0 +1,14 @@
+#pragma once
+
+#include "counter_rng.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Writes standard normal values for the given counters to out using the Box-Muller transform.
+// Two consecutive counters 2k and 2k + 1 share the random word of k and get the cosine and the sine
+// part of the transform, so each value is still a pure function of its counter.
+void FillStandardNormal(const CounterRng& rng, const uint64_t* counters, uint64_t count, double* out);
+
+} // namespace duckdb_faker
@@ -0,0 +1,67 @@
+#include "zipf_sampler.hpp"
+
+#include "counter_rng.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace duckdb_faker {
+
+namespace {
+// log1p(x) / x, which is also well-defined for x close to 0
+double log1p_over_x(const double x) {
+    if (std::abs(x) > 1e-8) {
+        return std::log1p(x) / x;
+    }
+    return 1 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+// expm1(x) / x, which is also well-defined for x close to 0
+double expm1_over_x(const double x) {
+    if (std::abs(x) > 1e-8) {
+        return std::expm1(x) / x;
+    }
+    return 1 + x * 0.5 * (1 + x * (1.0 / 3.0) * (1 + 0.25 * x));
+}
+} // namespace
+
+ZipfSampler::ZipfSampler(const uint64_t num_elements, const double skew) : num_elements(num_elements), skew(skew) {
+    h_integral_x1 = HIntegral(1.5) - 1;
+    h_integral_num_elements = HIntegral(static_cast<double>(num_elements) + 0.5);
+    s = 2 - HIntegralInverse(HIntegral(2.5) - H(2));
+}
+
+bool ZipfSampler::TrySample(const uint64_t word, uint64_t& rank) const {
+    const double u = h_integral_num_elements + UniformDouble(word) * (h_integral_x1 - h_integral_num_elements);
+    const double x = HIntegralInverse(u);
+    const double k = std::clamp(std::floor(x + 0.5), 1.0, static_cast<double>(num_elements));
+    if (k - x <= s || u >= HIntegral(k + 0.5) - H(k)) {
+        // For 2^64 - 1 elements, the upper bound rounds to 2^64, which does not fit into uint64_t
+        rank = k >= static_cast<double>(num_elements) ? num_elements : static_cast<uint64_t>(k);
+        return true;
+    }
+    return false;
+}
+
+// The unnormalized probability density 1 / x^skew
+double ZipfSampler::H(const double x) const {
+    return std::exp(-skew * std::log(x));
+}
+
+// Antiderivative of H, shifted such that it is continuous at skew = 1
+double ZipfSampler::HIntegral(const double x) const {
+    const double log_x = std::log(x);
+    return expm1_over_x((1 - skew) * log_x) * log_x;
+}
+
+double ZipfSampler::HIntegralInverse(const double x) const {
+    double t = x * (1 - skew);
+    if (t < -1) {
+        // Limit t to the domain of log1p
+        t = -1;
+    }
+    return std::exp(log1p_over_x(t) * x);
+}
+
+} // namespace duckdb_faker
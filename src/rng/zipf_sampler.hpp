@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Samples ranks in [1, num_elements] with probability proportional to 1 / rank^skew.
+// Uses rejection-inversion (Hoermann and Derflinger), which needs O(1) time per sample and no tables,
+// so it also works for huge domains. Rejections are rare; callers redraw with another random word.
+class ZipfSampler {
+public:
+    ZipfSampler(uint64_t num_elements, double skew);
+
+    // Maps a random word to a rank. Returns false if the word was rejected.
+    bool TrySample(uint64_t word, uint64_t& rank) const;
+
+private:
+    double H(double x) const;
+    double HIntegral(double x) const;
+    double HIntegralInverse(double x) const;
+
+    uint64_t num_elements;
+    double skew;
+    double h_integral_x1;
+    double h_integral_num_elements;
+    double s;
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,90 @@
+#include "choices.hpp"
+
+#include "column_generators/choice_column_generator.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/function/function.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+unique_ptr<FunctionData> RandomChoiceBind(ClientContext& context, TableFunctionBindInput& input,
+                                          vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    if (!input.named_parameters.contains("values")) {
+        throw InvalidInputException("values must be specified");
+    }
+    const auto& values_list = input.named_parameters["values"];
+    if (values_list.type().id() != LogicalTypeId::LIST || values_list.IsNull()) {
+        throw InvalidInputException("values must be a list");
+    }
+    const auto& values = ListValue::GetChildren(values_list);
+    if (values.empty()) {
+        throw InvalidInputException("values must not be empty");
+    }
+    const auto& type = ListType::GetChildType(values_list.type());
+    if (type.id() == LogicalTypeId::SQLNULL) {
+        throw InvalidInputException("Could not determine the type of values");
+    }
+
+    // Without weights, all values are equally likely
+    std::vector<double> weights(values.size(), 1.0);
+    if (input.named_parameters.contains("weights")) {
+        const auto& weights_list = input.named_parameters["weights"];
+        if (weights_list.IsNull()) {
+            throw InvalidInputException("weights must be a list");
+        }
+        const auto& weight_values = ListValue::GetChildren(weights_list);
+        if (weight_values.size() != values.size()) {
+            throw InvalidInputException("weights must have the same number of elements as values");
+        }
+        double total_weight = 0;
+        for (idx_t i = 0; i < weight_values.size(); i++) {
+            if (weight_values[i].IsNull()) {
+                throw InvalidInputException("weights must not contain NULL");
+            }
+            weights[i] = weight_values[i].GetValue<double>();
+            if (!std::isfinite(weights[i]) || weights[i] < 0) {
+                throw InvalidInputException("weights must be finite, non-negative numbers");
+            }
+            total_weight += weights[i];
+        }
+        if (total_weight <= 0 || !std::isfinite(total_weight)) {
+            throw InvalidInputException("weights must have a positive, finite sum");
+        }
+    }
+
+    bind_data->AddColumn(make_uniq<ChoiceColumnGenerator>(bind_data->seed, 0, type, values, weights));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+} // anonymous namespace
+
+void RandomChoiceFunction::RegisterFunction(ExtensionLoader& loader) {
+    TableFunction random_choice_function("random_choice", {}, GeneratorExecute, RandomChoiceBind);
+    random_choice_function.named_parameters["values"] = LogicalType::ANY;
+    random_choice_function.named_parameters["weights"] = LogicalType::LIST(LogicalType::DOUBLE);
+    ConfigureGeneratorFunction(random_choice_function);
+    loader.RegisterFunction(random_choice_function);
+}
+
+} // namespace duckdb_faker
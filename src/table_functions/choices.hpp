@@ -0,0 +1,11 @@
+#pragma once
+
+#include "utils/extension_loader_decl.hpp"
+
+namespace duckdb_faker {
+
+struct RandomChoiceFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+} // namespace duckdb_faker
@@ -0,0 +1,87 @@
+#include "generator_function.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/node_statistics.hpp"
+#include "generator_function_data.hpp"
+#include "generator_global_state.hpp"
+#include "generator_local_state.hpp"
+#include "rowid_filter_pushdown.hpp"
+#include "rowid_generator.hpp"
+#include "utils/client_context_decl.hpp"
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+unique_ptr<NodeStatistics> GeneratorCardinality(ClientContext&, const FunctionData* bind_data) {
+    // The number of rows is known exactly at bind time
+    const auto num_rows = bind_data->Cast<GeneratorFunctionData>().row_ranges.Count();
+    return make_uniq<NodeStatistics>(num_rows, num_rows);
+}
+
+unique_ptr<BaseStatistics> GeneratorStatistics(ClientContext&, const FunctionData* bind_data_p,
+                                               const column_t column_index) {
+    const auto& bind_data = bind_data_p->Cast<GeneratorFunctionData>();
+    if (column_index >= bind_data.columns.size()) {
+        // Virtual columns such as the rowid have no generator
+        return nullptr;
+    }
+    auto stats = bind_data.columns[column_index]->GetStatistics();
+    // There cannot be more distinct values than rows
+    const idx_t num_rows = bind_data.row_ranges.Count();
+    if (stats.GetDistinctCount() > num_rows) {
+        stats.SetDistinctCount(num_rows);
+    }
+    return stats.ToUnique();
+}
+} // namespace
+
+void GeneratorExecute(ClientContext&, TableFunctionInput& input, DataChunk& output) {
+    const auto& bind_data = input.bind_data->Cast<GeneratorFunctionData>();
+    auto& global_state = input.global_state->Cast<GeneratorGlobalState>();
+    auto& local_state = input.local_state->Cast<GeneratorLocalState>();
+
+    const idx_t cardinality = local_state.NextChunk(global_state);
+    output.SetCardinality(cardinality);
+    if (cardinality == 0) {
+        return;
+    }
+
+    const auto& column_indexes = global_state.column_indexes;
+    D_ASSERT(output.ColumnCount() ==
+             column_indexes.generated_columns.size() + (column_indexes.rowid_idx.IsValid() ? 1 : 0));
+
+    for (const auto& column : column_indexes.generated_columns) {
+        const auto& generator = bind_data.columns[column.generator_idx];
+        Vector& result = output.data[column.output_idx];
+        D_ASSERT(result.GetType() == generator->type);
+        generator->Generate(local_state.chunk_rowids, cardinality, result);
+    }
+
+    if (column_indexes.rowid_idx.IsValid()) {
+        rowid_generator::PopulateRowIdColumn(local_state.chunk_start_rowid, column_indexes.rowid_idx, output);
+    }
+}
+
+void ConfigureGeneratorFunction(TableFunction& function) {
+    function.named_parameters["seed"] = LogicalType::UBIGINT;
+    function.named_parameters["rows"] = LogicalType::UBIGINT;
+    function.named_parameters["null_probability"] = LogicalType::DOUBLE;
+    function.cardinality = GeneratorCardinality;
+    function.statistics = GeneratorStatistics;
+    function.init_global = GeneratorGlobalInit;
+    function.init_local = GeneratorLocalInit;
+    function.get_partition_data = GeneratorGetPartitionData;
+    function.projection_pushdown = true;
+    function.pushdown_complex_filter = PushdownRowIdFilters;
+    function.get_virtual_columns = rowid_generator::GetVirtualColumns;
+    function.get_row_id_columns = rowid_generator::GetRowIdColumns;
+}
+
+} // namespace duckdb_faker
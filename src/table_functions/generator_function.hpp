@@ -0,0 +1,19 @@
+#pragma once
+
+#include "utils/client_context_decl.hpp"
+
+namespace duckdb {
+class DataChunk;
+class TableFunction;
+struct TableFunctionInput;
+} // namespace duckdb
+
+namespace duckdb_faker {
+
+// Fills the projected columns of the output chunk using the column generators of the bind data
+void GeneratorExecute(duckdb::ClientContext& context, duckdb::TableFunctionInput& input, duckdb::DataChunk& output);
+
+// Sets the callbacks and named parameters that all generator table functions have in common
+void ConfigureGeneratorFunction(duckdb::TableFunction& function);
+
+} // namespace duckdb_faker
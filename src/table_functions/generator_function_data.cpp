@@ -0,0 +1,74 @@
+#include "generator_function_data.hpp"
+
+#include "column_generators/nullable_column_generator.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+uint64_t get_default_seed(ClientContext& context) {
+    // Use the random engine of the client, so that the output can also be made reproducible with setseed()
+    auto& random_engine = RandomEngine::Get(context);
+    lock_guard<mutex> guard(random_engine.lock);
+    const uint64_t upper = random_engine.NextRandomInteger();
+    const uint64_t lower = random_engine.NextRandomInteger();
+    return (upper << 32) | lower;
+}
+} // namespace
+
+void GeneratorFunctionData::BindCommonParameters(ClientContext& context, TableFunctionBindInput& input) {
+    if (input.named_parameters.contains("seed")) {
+        seed = input.named_parameters["seed"].GetValue<uint64_t>();
+    } else {
+        seed = get_default_seed(context);
+    }
+
+    if (input.named_parameters.contains("rows")) {
+        max_generated_rows = input.named_parameters["rows"].GetValue<uint64_t>();
+        if (max_generated_rows > MAX_GENERATED_ROWS_LIMIT) {
+            throw InvalidInputException("rows must be less than or equal to 2^63");
+        }
+    }
+    row_ranges = RowRanges::Range(0, max_generated_rows);
+
+    // random_data also accepts a struct with per-column probabilities, which it parses itself
+    if (input.named_parameters.contains("null_probability") &&
+        input.named_parameters["null_probability"].type().id() != LogicalTypeId::STRUCT) {
+        null_probability = ParseNullProbability(input.named_parameters["null_probability"]);
+    }
+}
+
+void GeneratorFunctionData::AddColumn(unique_ptr<ColumnGenerator> generator,
+                                      const std::optional<double> column_null_probability) {
+    const double resolved_null_probability = column_null_probability.value_or(null_probability);
+    if (resolved_null_probability > 0) {
+        // Every column gets its own RNG stream, keyed by the position of the column
+        const idx_t column_idx = columns.size();
+        generator =
+            make_uniq<NullableColumnGenerator>(std::move(generator), seed, column_idx, resolved_null_probability);
+    }
+    columns.push_back(std::move(generator));
+}
+
+double GeneratorFunctionData::ParseNullProbability(const Value& value) {
+    const double result = value.GetValue<double>();
+    if (!(result >= 0 && result <= 1)) {
+        throw InvalidInputException("null_probability must be between 0 and 1");
+    }
+    return result;
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "column_generators/column_generator.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "row_ranges.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace duckdb_faker {
+
+// Bind data shared by all generator table functions
+struct GeneratorFunctionData : duckdb::TableFunctionData {
+    static constexpr uint64_t DEFAULT_MAX_GENERATED_ROWS = STANDARD_VECTOR_SIZE * 64;
+    // The rowid is a BIGINT, so the largest rowid is 2^63 - 1
+    static constexpr uint64_t MAX_GENERATED_ROWS_LIMIT = static_cast<uint64_t>(1) << 63;
+
+    // Parses the named parameters that all generators have in common
+    void BindCommonParameters(duckdb::ClientContext& context, duckdb::TableFunctionBindInput& input);
+    // Adds the generator of the next output column. Its values are NULL with the given probability,
+    // which defaults to the null_probability parameter.
+    void AddColumn(duckdb::unique_ptr<ColumnGenerator> generator, std::optional<double> column_null_probability = {});
+
+    static double ParseNullProbability(const duckdb::Value& value);
+
+    // Seed of the counter-based RNG.
+    // It is fixed at bind time, so every value only depends on the seed and its rowid.
+    uint64_t seed = 0;
+    // Number of rows of the generated table
+    uint64_t max_generated_rows = DEFAULT_MAX_GENERATED_ROWS;
+    // Rows that are actually generated. Filters on the rowid can narrow them down.
+    RowRanges row_ranges = RowRanges::Range(0, DEFAULT_MAX_GENERATED_ROWS);
+    // Probability of NULL values for all columns
+    double null_probability = 0.0;
+    // One generator per (non-virtual) output column
+    duckdb::vector<duckdb::unique_ptr<ColumnGenerator>> columns;
+};
+
+} // namespace duckdb_faker
@@ -2,8 +2,15 @@
 
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/unique_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "generator_function_data.hpp"
+#include "row_ranges.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <algorithm>
+#include <cstdint>
 
 using namespace duckdb;
 
@@ -13,20 +20,19 @@ namespace {
 GeneratorColumnIndexes get_column_indexes(const TableFunctionInitInput& input) {
     GeneratorColumnIndexes column_indexes;
 
-    // There are only two columns: the 'value' column and the virtual 'rowid' column
     // input.column_indexes contains the indices of columns that are projected or filtered on.
+    // Besides the generated columns, it may contain the virtual 'rowid' column.
     for (idx_t p = 0; p < input.column_indexes.size(); p++) {
         if (input.column_indexes[p].IsRowIdColumn()) {
             D_ASSERT(!column_indexes.rowid_idx.IsValid()); // There should only be one 'rowid' column
             column_indexes.rowid_idx = p;
         } else {
-            D_ASSERT(!column_indexes.value_idx.IsValid()); // There should only be one 'value' column
-            column_indexes.value_idx = p;
+            column_indexes.generated_columns.push_back({p, input.column_indexes[p].GetPrimaryIndex()});
         }
     }
 
     // At least one of the columns should be projected
-    D_ASSERT(column_indexes.value_idx.IsValid() || column_indexes.rowid_idx.IsValid());
+    D_ASSERT(!column_indexes.generated_columns.empty() || column_indexes.rowid_idx.IsValid());
 
     return column_indexes;
 }
@@ -34,6 +40,39 @@ GeneratorColumnIndexes get_column_indexes(const TableFunctionInitInput& input) {
 
 GeneratorGlobalState::GeneratorGlobalState(const TableFunctionInitInput& input) {
     column_indexes = get_column_indexes(input);
+
+    // Every range is split into morsels separately, so a morsel never spans multiple ranges
+    const auto& row_ranges = input.bind_data->Cast<GeneratorFunctionData>().row_ranges;
+    for (const auto& range : row_ranges.Ranges()) {
+        ranges.push_back(range);
+        first_morsel_indexes.push_back(num_morsels);
+        num_morsels += (range.end - range.start + MORSEL_SIZE - 1) / MORSEL_SIZE;
+    }
+}
+
+idx_t GeneratorGlobalState::MaxThreads() const {
+    return num_morsels == 0 ? 1 : num_morsels;
+}
+
+bool GeneratorGlobalState::ClaimMorsel(Morsel& morsel) {
+    const uint64_t morsel_index = next_morsel_index.fetch_add(1);
+    if (morsel_index >= num_morsels) {
+        return false;
+    }
+
+    // Find the range that contains the morsel
+    const auto range_it = std::upper_bound(first_morsel_indexes.cbegin(), first_morsel_indexes.cend(), morsel_index);
+    const auto range_idx = static_cast<idx_t>(range_it - first_morsel_indexes.cbegin()) - 1;
+    const auto& range = ranges[range_idx];
+
+    morsel.index = morsel_index;
+    morsel.start_rowid = range.start + (morsel_index - first_morsel_indexes[range_idx]) * MORSEL_SIZE;
+    morsel.end_rowid = std::min(morsel.start_rowid + MORSEL_SIZE, range.end);
+    return true;
+}
+
+unique_ptr<GlobalTableFunctionState> GeneratorGlobalInit(ClientContext&, TableFunctionInitInput& input) {
+    return make_uniq<GeneratorGlobalState>(input);
 }
 
 } // namespace duckdb_faker
\ No newline at end of file
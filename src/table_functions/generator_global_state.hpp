@@ -1,28 +1,59 @@
 #pragma once
 
 #include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/vector.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "row_ranges.hpp"
 
+#include <atomic>
 #include <cstdint>
 
 namespace duckdb_faker {
 
-// The generator table functions only have two columns:
-// The 'value' column containing the actual result and the virtual 'rowid' column.
-// If any of the columns is not projected, the index will be invalid.
+// A projected column that is produced by one of the column generators
+struct GeneratedColumnIndex {
+    // Index of the column in the output chunk
+    duckdb::idx_t output_idx;
+    // Index of the column generator in the bind data
+    duckdb::idx_t generator_idx;
+};
+
+// Maps the projected columns to the columns of the output chunk.
+// If the virtual 'rowid' column is not projected, its index will be invalid.
 struct GeneratorColumnIndexes {
     duckdb::optional_idx rowid_idx;
-    duckdb::optional_idx value_idx;
+    duckdb::vector<GeneratedColumnIndex> generated_columns;
+};
+
+// A contiguous range of rows [start_rowid, end_rowid) that is generated by a single thread
+struct Morsel {
+    uint64_t index;
+    uint64_t start_rowid;
+    uint64_t end_rowid;
 };
 
-struct GeneratorGlobalState : duckdb::GlobalTableFunctionState {
-    static constexpr uint64_t DEFAULT_MAX_GENERATED_ROWS = STANDARD_VECTOR_SIZE * 64;
+struct GeneratorGlobalState final : duckdb::GlobalTableFunctionState {
+    // Number of rows a thread claims at once
+    static constexpr uint64_t MORSEL_SIZE = STANDARD_VECTOR_SIZE * 8;
 
     explicit GeneratorGlobalState(const duckdb::TableFunctionInitInput& input);
 
-    uint64_t num_generated_rows = 0;
-    uint64_t max_generated_rows = DEFAULT_MAX_GENERATED_ROWS;
+    duckdb::idx_t MaxThreads() const override;
+
+    // Claims the next range of rows. Returns false if all rows have been claimed already.
+    bool ClaimMorsel(Morsel& morsel);
+
     GeneratorColumnIndexes column_indexes;
+
+private:
+    // The rows to generate and, for each range, the index of its first morsel
+    duckdb::vector<RowRange> ranges;
+    duckdb::vector<uint64_t> first_morsel_indexes;
+    uint64_t num_morsels = 0;
+    std::atomic<uint64_t> next_morsel_index = 0;
 };
 
-} // namespace duckdb_faker
\ No newline at end of file
+duckdb::unique_ptr<duckdb::GlobalTableFunctionState> GeneratorGlobalInit(duckdb::ClientContext& context,
+                                                                         duckdb::TableFunctionInitInput& input);
+
+} // namespace duckdb_faker
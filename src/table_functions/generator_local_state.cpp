@@ -0,0 +1,43 @@
+#include "generator_local_state.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "generator_global_state.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+idx_t GeneratorLocalState::NextChunk(GeneratorGlobalState& global_state) {
+    if (morsel.start_rowid == morsel.end_rowid && !global_state.ClaimMorsel(morsel)) {
+        return 0;
+    }
+
+    chunk_start_rowid = morsel.start_rowid;
+    const idx_t cardinality = std::min<uint64_t>(morsel.end_rowid - morsel.start_rowid, STANDARD_VECTOR_SIZE);
+    morsel.start_rowid += cardinality;
+    for (idx_t row_idx = 0; row_idx < cardinality; row_idx++) {
+        chunk_rowids[row_idx] = chunk_start_rowid + row_idx;
+    }
+    return cardinality;
+}
+
+unique_ptr<LocalTableFunctionState> GeneratorLocalInit(ExecutionContext&, TableFunctionInitInput&,
+                                                       GlobalTableFunctionState*) {
+    return make_uniq<GeneratorLocalState>();
+}
+
+OperatorPartitionData GeneratorGetPartitionData(ClientContext&, TableFunctionGetPartitionInput& input) {
+    if (input.partition_info.RequiresPartitionColumns()) {
+        throw InternalException("Generator functions do not support partition columns");
+    }
+    const auto& local_state = input.local_state->Cast<GeneratorLocalState>();
+    return OperatorPartitionData(local_state.morsel.index);
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "duckdb/function/table_function.hpp"
+#include "generator_global_state.hpp"
+
+#include <cstdint>
+
+namespace duckdb_faker {
+
+// Per-thread state of the generator table functions.
+// Every thread claims morsels from the global state and generates them chunk by chunk.
+struct GeneratorLocalState final : duckdb::LocalTableFunctionState {
+    // Determines the rows of the next chunk and returns the cardinality of the chunk.
+    // Returns 0 if there are no rows left to generate.
+    duckdb::idx_t NextChunk(GeneratorGlobalState& global_state);
+
+    // Rows of the chunk returned by the last call to NextChunk
+    uint64_t chunk_start_rowid = 0;
+    uint64_t chunk_rowids[STANDARD_VECTOR_SIZE];
+    Morsel morsel {0, 0, 0};
+};
+
+duckdb::unique_ptr<duckdb::LocalTableFunctionState> GeneratorLocalInit(duckdb::ExecutionContext& context,
+                                                                       duckdb::TableFunctionInitInput& input,
+                                                                       duckdb::GlobalTableFunctionState* global_state);
+
+// Returns the index of the current morsel as batch index, so that the order of the rows can be preserved.
+duckdb::OperatorPartitionData GeneratorGetPartitionData(duckdb::ClientContext& context,
+                                                        duckdb::TableFunctionGetPartitionInput& input);
+
+} // namespace duckdb_faker
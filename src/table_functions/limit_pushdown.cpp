@@ -0,0 +1,80 @@
+#include "limit_pushdown.hpp"
+
+#include "duckdb/common/enums/logical_operator_type.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_limit.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+optional_ptr<LogicalGet> find_generator_scan(LogicalOperator& op) {
+    // Projections neither change the number nor the order of rows
+    auto* current = &op;
+    while (current->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+        current = current->children[0].get();
+    }
+    if (current->type != LogicalOperatorType::LOGICAL_GET) {
+        return nullptr;
+    }
+    auto& get = current->Cast<LogicalGet>();
+    if (get.function.function != GeneratorExecute) {
+        return nullptr;
+    }
+    return &get;
+}
+
+void pushdown_limits(LogicalOperator& op) {
+    // Push down inner limits first, so that outer limits apply to the already limited rows
+    for (auto& child : op.children) {
+        pushdown_limits(*child);
+    }
+    if (op.type != LogicalOperatorType::LOGICAL_LIMIT) {
+        return;
+    }
+    auto& limit = op.Cast<LogicalLimit>();
+    const auto get = find_generator_scan(*limit.children[0]);
+    if (!get) {
+        return;
+    }
+
+    const auto offset_type = limit.offset_val.Type();
+    if (offset_type != LimitNodeType::UNSET && offset_type != LimitNodeType::CONSTANT_VALUE) {
+        return;
+    }
+    // A percentage limit is taken of all rows including the offset ones, so they must not be skipped
+    const auto limit_type = limit.limit_val.Type();
+    if (limit_type != LimitNodeType::UNSET && limit_type != LimitNodeType::CONSTANT_VALUE) {
+        return;
+    }
+    // Rows are emitted in rowid order, so the limited rows are exactly the first rows of the ranges
+    auto& bind_data = get->bind_data->Cast<GeneratorFunctionData>();
+    if (offset_type == LimitNodeType::CONSTANT_VALUE) {
+        bind_data.row_ranges.Skip(limit.offset_val.GetConstantValue());
+        limit.offset_val = BoundLimitNode();
+    }
+    if (limit_type == LimitNodeType::CONSTANT_VALUE) {
+        bind_data.row_ranges.Truncate(limit.limit_val.GetConstantValue());
+    }
+}
+
+void limit_pushdown_optimize(OptimizerExtensionInput&, unique_ptr<LogicalOperator>& plan) {
+    pushdown_limits(*plan);
+}
+} // namespace
+
+void RegisterLimitPushdown(ExtensionLoader& loader) {
+    OptimizerExtension extension;
+    extension.optimize_function = limit_pushdown_optimize;
+    DBConfig::GetConfig(loader.GetDatabaseInstance()).optimizer_extensions.push_back(std::move(extension));
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "utils/extension_loader_decl.hpp"
+
+namespace duckdb_faker {
+
+// Registers an optimizer extension that pushes constant LIMIT/OFFSET clauses into generator scans.
+// The scan then starts directly at the offset instead of generating and discarding the skipped rows.
+void RegisterLimitPushdown(duckdb::ExtensionLoader& loader);
+
+} // namespace duckdb_faker
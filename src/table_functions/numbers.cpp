@@ -1,22 +1,28 @@
 #include "numbers.hpp"
 
-#include "duckdb/common/assert.hpp"
+#include "column_generators/column_generator_factory.hpp"
+#include "column_generators/float_column_generator.hpp"
+#include "column_generators/int_column_generator.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/hugeint.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/types.hpp"
-#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/decimal.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/uhugeint.hpp"
 #include "duckdb/common/unique_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/function/function.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
-#include "faker-cxx/number.h"
-#include "generator_global_state.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
 #include "probability_distributions.hpp"
-#include "rowid_generator.hpp"
 #include "utils/client_context_decl.hpp"
 
+#include <cmath>
 #include <cstdint>
-#include <limits>
 #include <optional>
 #include <string>
 
@@ -25,106 +31,221 @@ using namespace duckdb;
 namespace duckdb_faker {
 
 namespace {
-struct RandomIntFunctionData final : TableFunctionData {
-    std::optional<int32_t> min;
-    std::optional<int32_t> max;
-    std::optional<ProbabilityDistribution::Type> distribution;
-};
+ProbabilityDistribution::Type bind_distribution(TableFunctionBindInput& input) {
+    ProbabilityDistribution::Type distribution = ProbabilityDistribution::Type::UNIFORM;
+    if (input.named_parameters.contains("distribution")) {
+        const std::string distribution_str = input.named_parameters["distribution"].GetValue<string>();
+        const std::optional<ProbabilityDistribution::Type> parsed_distribution =
+            ProbabilityDistribution::FromString(distribution_str);
+        if (!parsed_distribution.has_value()) {
+            throw InvalidInputException("Unknown probability distribution \"%s\"", distribution_str);
+        }
+        distribution = parsed_distribution.value();
+    }
+    return distribution;
+}
 
-struct IntGeneratorGlobalState final : GeneratorGlobalState {
-    explicit IntGeneratorGlobalState(const TableFunctionInitInput& input) : GeneratorGlobalState(input) {
+DistributionParameters bind_distribution_parameters(TableFunctionBindInput& input,
+                                                    const ProbabilityDistribution::Type distribution, const double min,
+                                                    const double max) {
+    DistributionParameters parameters;
+    if (distribution == ProbabilityDistribution::Type::NORMAL &&
+        (input.named_parameters.contains("min") || input.named_parameters.contains("max"))) {
+        // Center the values in the given bounds, which then lie three standard deviations away from the mean
+        parameters.mean = min / 2 + max / 2;
+        parameters.stddev = max / 6 - min / 6;
+    }
+    if (input.named_parameters.contains("mean") || input.named_parameters.contains("stddev")) {
+        if (distribution != ProbabilityDistribution::Type::NORMAL) {
+            throw InvalidInputException("mean and stddev can only be specified for the normal distribution");
+        }
+    }
+    if (input.named_parameters.contains("mean")) {
+        parameters.mean = input.named_parameters["mean"].GetValue<double>();
+        if (!std::isfinite(parameters.mean)) {
+            throw InvalidInputException("mean must be a finite number");
+        }
+    }
+    if (input.named_parameters.contains("skew")) {
+        if (distribution != ProbabilityDistribution::Type::ZIPF) {
+            throw InvalidInputException("skew can only be specified for the zipf distribution");
+        }
+        parameters.skew = input.named_parameters["skew"].GetValue<double>();
+        if (!std::isfinite(parameters.skew) || parameters.skew <= 0) {
+            throw InvalidInputException("skew must be a finite, positive number");
+        }
+    }
+    if (input.named_parameters.contains("stddev")) {
+        parameters.stddev = input.named_parameters["stddev"].GetValue<double>();
+        if (!std::isfinite(parameters.stddev) || parameters.stddev < 0) {
+            throw InvalidInputException("stddev must be a finite, non-negative number");
+        }
     }
-};
+    return parameters;
+}
 
-unique_ptr<FunctionData> RandomIntBind(ClientContext&, TableFunctionBindInput& input, vector<LogicalType>& return_types,
-                                       vector<string>& names) {
-    names.push_back("value");
-    return_types.push_back(LogicalType::INTEGER);
+// min and max are declared with the type of the function, so DuckDB rejects out-of-range bounds when casting them
+template <typename T>
+unique_ptr<FunctionData> RandomIntegerBind(ClientContext& context, TableFunctionBindInput& input,
+                                           vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
 
-    auto bind_data = make_uniq<RandomIntFunctionData>();
+    T min = NumericLimits<T>::Minimum();
+    T max = NumericLimits<T>::Maximum();
     if (input.named_parameters.contains("min")) {
-        bind_data->min = input.named_parameters["min"].GetValue<int32_t>();
+        min = input.named_parameters["min"].GetValue<T>();
     }
     if (input.named_parameters.contains("max")) {
-        bind_data->max = input.named_parameters["max"].GetValue<int32_t>();
+        max = input.named_parameters["max"].GetValue<T>();
     }
 
-    if (bind_data->min.has_value() && bind_data->max.has_value() && bind_data->min.value() > bind_data->max.value()) {
+    if (min > max) {
         throw InvalidInputException("Minimum value must be less than or equal to maximum value");
     }
 
-    if (input.named_parameters.contains("distribution")) {
-        const std::string distribution_str = input.named_parameters["distribution"].GetValue<string>();
-        const std::optional<ProbabilityDistribution::Type> distribution =
-            ProbabilityDistribution::FromString(distribution_str);
-        if (!distribution.has_value()) {
-            throw InvalidInputException("Unknown probability distribution \"%s\"", distribution_str);
-        }
-        bind_data->distribution = distribution;
-    }
+    const ProbabilityDistribution::Type distribution = bind_distribution(input);
+    const DistributionParameters parameters = bind_distribution_parameters(
+        input, distribution, Cast::Operation<T, double>(min), Cast::Operation<T, double>(max));
+
+    bind_data->AddColumn(make_uniq<IntColumnGenerator<T>>(bind_data->seed, 0, min, max, distribution, parameters));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
 
     return bind_data;
 }
 
-unique_ptr<GlobalTableFunctionState> RandomIntGlobalInit(ClientContext&, TableFunctionInitInput& input) {
-    return make_uniq<IntGeneratorGlobalState>(input);
+template <typename T>
+unique_ptr<FunctionData> RandomFloatBind(ClientContext& context, TableFunctionBindInput& input,
+                                         vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    const ProbabilityDistribution::Type distribution = bind_distribution(input);
+    if (distribution == ProbabilityDistribution::Type::ZIPF) {
+        throw InvalidInputException("The zipf distribution is only supported for integers");
+    }
+
+    // Uniform values default to [0, 1], whereas normal values are not bounded by default
+    const bool is_uniform = distribution == ProbabilityDistribution::Type::UNIFORM;
+    T min = is_uniform ? 0 : NumericLimits<T>::Minimum();
+    T max = is_uniform ? 1 : NumericLimits<T>::Maximum();
+    if (input.named_parameters.contains("min")) {
+        min = input.named_parameters["min"].GetValue<T>();
+    }
+    if (input.named_parameters.contains("max")) {
+        max = input.named_parameters["max"].GetValue<T>();
+    }
+
+    if (!std::isfinite(min) || !std::isfinite(max)) {
+        throw InvalidInputException("Minimum and maximum value must be finite numbers");
+    }
+    if (min > max) {
+        throw InvalidInputException("Minimum value must be less than or equal to maximum value");
+    }
+    const DistributionParameters parameters = bind_distribution_parameters(input, distribution, min, max);
+
+    bind_data->AddColumn(make_uniq<FloatColumnGenerator<T>>(bind_data->seed, 0, min, max, distribution, parameters));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
 }
 
-void RandomIntExecute(ClientContext&, TableFunctionInput& input, DataChunk& output) {
-    auto& state = input.global_state->Cast<IntGeneratorGlobalState>();
-
-    D_ASSERT(state.num_generated_rows <= state.max_generated_rows); // We don't want to underflow
-    const auto num_remaining_rows = state.max_generated_rows - state.num_generated_rows;
-    const idx_t cardinality = num_remaining_rows < STANDARD_VECTOR_SIZE ? num_remaining_rows : STANDARD_VECTOR_SIZE;
-    output.SetCardinality(cardinality);
-
-    if (state.column_indexes.value_idx.IsValid() && state.column_indexes.rowid_idx.IsValid()) {
-        D_ASSERT(output.ColumnCount() == 2);
-    } else {
-        D_ASSERT(output.ColumnCount() == 1);
-    }
-
-    const auto& bind_data = input.bind_data->Cast<RandomIntFunctionData>();
-    const int32_t min = bind_data.min.value_or(std::numeric_limits<int32_t>::min());
-    const int32_t max = bind_data.max.value_or(std::numeric_limits<int32_t>::max());
-    const ProbabilityDistribution::Type distribution =
-        bind_data.distribution.value_or(ProbabilityDistribution::Type::UNIFORM);
-
-    const optional_idx value_col_idx = state.column_indexes.value_idx;
-    if (value_col_idx.IsValid()) {
-        Vector& value_vector = output.data[value_col_idx.GetIndex()];
-        D_ASSERT(value_vector.GetType().id() == LogicalTypeId::INTEGER);
-        D_ASSERT(LogicalType(LogicalType::INTEGER).InternalType() == duckdb::GetTypeId<int32_t>());
-        D_ASSERT(value_vector.GetVectorType() == VectorType::FLAT_VECTOR);
-        int32_t* data = FlatVector::GetData<int32_t>(value_vector);
-
-        // We only support one distribution for now
-        if (distribution == ProbabilityDistribution::Type::UNIFORM) {
-            for (idx_t row_idx = 0; row_idx < cardinality; row_idx++) {
-                const int32_t random_num = faker::number::integer(min, max);
-                data[row_idx] = random_num;
-            }
+// min and max are accepted as any type and cast to the decimal type exactly, without a round-trip through double
+unique_ptr<FunctionData> RandomDecimalBind(ClientContext& context, TableFunctionBindInput& input,
+                                           vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    // Same defaults as DECIMAL without width and scale
+    int32_t width = 18;
+    int32_t scale = 3;
+    if (input.named_parameters.contains("width")) {
+        width = input.named_parameters["width"].GetValue<int32_t>();
+        if (width < 1 || width > Decimal::MAX_WIDTH_DECIMAL) {
+            throw InvalidInputException("width must be between 1 and 38");
         }
     }
+    if (input.named_parameters.contains("scale")) {
+        scale = input.named_parameters["scale"].GetValue<int32_t>();
+    }
+    if (scale < 0 || scale > width) {
+        throw InvalidInputException("scale must be between 0 and width");
+    }
 
-    const auto rowid_col_idx = state.column_indexes.rowid_idx;
-    if (rowid_col_idx.IsValid()) {
-        rowid_generator::PopulateRowIdColumn(state.num_generated_rows, rowid_col_idx, output);
+    Value min;
+    Value max;
+    if (input.named_parameters.contains("min")) {
+        min = input.named_parameters["min"];
+    }
+    if (input.named_parameters.contains("max")) {
+        max = input.named_parameters["max"];
     }
 
-    state.num_generated_rows += cardinality;
+    const LogicalType type = LogicalType::DECIMAL(static_cast<uint8_t>(width), static_cast<uint8_t>(scale));
+    bind_data->AddColumn(CreateDecimalColumnGenerator(type, bind_data->seed, 0, min, max));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+
+template <typename T>
+void register_integer_function(ExtensionLoader& loader, const string& name, const LogicalType& type) {
+    TableFunction function(name, {}, GeneratorExecute, RandomIntegerBind<T>);
+    function.named_parameters["min"] = type;
+    function.named_parameters["max"] = type;
+    function.named_parameters["distribution"] = LogicalType::VARCHAR;
+    function.named_parameters["mean"] = LogicalType::DOUBLE;
+    function.named_parameters["stddev"] = LogicalType::DOUBLE;
+    function.named_parameters["skew"] = LogicalType::DOUBLE;
+    ConfigureGeneratorFunction(function);
+    loader.RegisterFunction(function);
+}
+
+template <typename T>
+void register_float_function(ExtensionLoader& loader, const string& name, const LogicalType& type) {
+    TableFunction function(name, {}, GeneratorExecute, RandomFloatBind<T>);
+    function.named_parameters["min"] = type;
+    function.named_parameters["max"] = type;
+    function.named_parameters["distribution"] = LogicalType::VARCHAR;
+    function.named_parameters["mean"] = LogicalType::DOUBLE;
+    function.named_parameters["stddev"] = LogicalType::DOUBLE;
+    ConfigureGeneratorFunction(function);
+    loader.RegisterFunction(function);
 }
 } // anonymous namespace
 
 void RandomIntFunction::RegisterFunction(ExtensionLoader& loader) {
-    TableFunction random_int_function("random_int", {}, RandomIntExecute, RandomIntBind, RandomIntGlobalInit);
-    random_int_function.named_parameters["min"] = LogicalType::INTEGER;
-    random_int_function.named_parameters["max"] = LogicalType::INTEGER;
-    random_int_function.named_parameters["distribution"] = LogicalType::VARCHAR;
-    random_int_function.projection_pushdown = true;
-    random_int_function.get_virtual_columns = rowid_generator::GetVirtualColumns;
-    random_int_function.get_row_id_columns = rowid_generator::GetRowIdColumns;
-    loader.RegisterFunction(random_int_function);
+    register_integer_function<int8_t>(loader, "random_tinyint", LogicalType::TINYINT);
+    register_integer_function<int16_t>(loader, "random_smallint", LogicalType::SMALLINT);
+    register_integer_function<int32_t>(loader, "random_int", LogicalType::INTEGER);
+    register_integer_function<int64_t>(loader, "random_bigint", LogicalType::BIGINT);
+    register_integer_function<hugeint_t>(loader, "random_hugeint", LogicalType::HUGEINT);
+    register_integer_function<uint8_t>(loader, "random_utinyint", LogicalType::UTINYINT);
+    register_integer_function<uint16_t>(loader, "random_usmallint", LogicalType::USMALLINT);
+    register_integer_function<uint32_t>(loader, "random_uinteger", LogicalType::UINTEGER);
+    register_integer_function<uint64_t>(loader, "random_ubigint", LogicalType::UBIGINT);
+    register_integer_function<uhugeint_t>(loader, "random_uhugeint", LogicalType::UHUGEINT);
+}
+
+void RandomDecimalFunction::RegisterFunction(ExtensionLoader& loader) {
+    TableFunction random_decimal_function("random_decimal", {}, GeneratorExecute, RandomDecimalBind);
+    random_decimal_function.named_parameters["width"] = LogicalType::INTEGER;
+    random_decimal_function.named_parameters["scale"] = LogicalType::INTEGER;
+    random_decimal_function.named_parameters["min"] = LogicalType::ANY;
+    random_decimal_function.named_parameters["max"] = LogicalType::ANY;
+    ConfigureGeneratorFunction(random_decimal_function);
+    loader.RegisterFunction(random_decimal_function);
+}
+
+void RandomFloatFunction::RegisterFunction(ExtensionLoader& loader) {
+    register_float_function<float>(loader, "random_float", LogicalType::FLOAT);
+    register_float_function<double>(loader, "random_double", LogicalType::DOUBLE);
 }
 
 } // namespace duckdb_faker
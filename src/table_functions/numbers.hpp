@@ -8,4 +8,12 @@ struct RandomIntFunction {
     static void RegisterFunction(duckdb::ExtensionLoader& loader);
 };
 
+struct RandomDecimalFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+struct RandomFloatFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
 } // namespace duckdb_faker
@@ -11,15 +11,32 @@ namespace duckdb_faker {
 class ProbabilityDistribution {
 public:
     enum class Type : uint8_t {
-        UNIFORM = 0
+        UNIFORM = 0,
+        NORMAL = 1,
+        ZIPF = 2
     };
 
     static std::optional<Type> FromString(const std::string& input) {
         if (duckdb::StringUtil::CIEquals(input, "uniform")) {
             return std::make_optional(Type::UNIFORM);
         }
+        if (duckdb::StringUtil::CIEquals(input, "normal") || duckdb::StringUtil::CIEquals(input, "gaussian")) {
+            return std::make_optional(Type::NORMAL);
+        }
+        if (duckdb::StringUtil::CIEquals(input, "zipf") || duckdb::StringUtil::CIEquals(input, "zipfian")) {
+            return std::make_optional(Type::ZIPF);
+        }
         return std::nullopt;
     }
 };
 
+// Parameters of the probability distributions. Each distribution only uses some of them.
+struct DistributionParameters {
+    // Normal distribution, which is centered in [min, max] instead if only the bounds are given
+    double mean = 0.0;
+    double stddev = 1.0;
+    // Zipf distribution
+    double skew = 1.0;
+};
+
 } // namespace duckdb_faker
\ No newline at end of file
@@ -1,45 +1,46 @@
 #include "random_data.hpp"
 
+#include "column_generators/column_generator_factory.hpp"
+#include "column_generators/foreign_key_column_generator.hpp"
+#include "column_generators/list_column_generator.hpp"
 #include "duckdb/catalog/catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/vector.hpp"
-#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/parser/column_definition.hpp"
-#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/constraint.hpp"
+#include "duckdb/parser/constraints/foreign_key_constraint.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
 #include "duckdb/parser/qualified_name.hpp"
-#include "duckdb/parser/tableref.hpp"
-#include "duckdb/parser/tableref/subqueryref.hpp"
 #include "duckdb/planner/binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
+#include "table_profile.hpp"
 
-#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 
 using namespace duckdb;
 
 namespace duckdb_faker {
 
 namespace {
-std::string logical_type_to_generator_name(const LogicalType& type) {
-    switch (type.id()) {
-    case LogicalTypeId::BOOLEAN:
-        return "random_bool";
-    case LogicalTypeId::TINYINT:
-    case LogicalTypeId::SMALLINT:
-    case LogicalTypeId::INTEGER:
-        return "random_int";
-    case LogicalTypeId::VARCHAR:
-        return "random_string";
-    default:
-        throw NotImplementedException("Random data generation not implemented for type: %s", type.ToString());
-    }
-}
-
-unique_ptr<TableRef> RandomDataBindReplace(ClientContext& context, TableFunctionBindInput& input) {
+TableCatalogEntry& get_schema_source(ClientContext& context, TableFunctionBindInput& input) {
     const auto schema_source_it = input.named_parameters.find("schema_source");
     if (schema_source_it == input.named_parameters.cend()) {
         throw InvalidInputException("Missing required named parameter: schema_source");
@@ -53,67 +54,372 @@ unique_ptr<TableRef> RandomDataBindReplace(ClientContext& context, TableFunction
     CatalogEntry& entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, catalog, schema, entry_name);
 
     D_ASSERT(entry.type == TableCatalogEntry::Type);
-    const auto& table_entry = entry.Cast<TableCatalogEntry>();
+    return entry.Cast<TableCatalogEntry>();
+}
+
+// Parses null_probability given as a struct that maps column names to probabilities
+case_insensitive_map_t<double> get_column_null_probabilities(const TableCatalogEntry& table_entry,
+                                                             TableFunctionBindInput& input) {
+    case_insensitive_map_t<double> result;
+    const auto it = input.named_parameters.find("null_probability");
+    if (it == input.named_parameters.cend() || it->second.type().id() != LogicalTypeId::STRUCT) {
+        return result;
+    }
+    const auto& child_types = StructType::GetChildTypes(it->second.type());
+    const auto& children = StructValue::GetChildren(it->second);
+    for (idx_t i = 0; i < children.size(); i++) {
+        const auto& column_name = child_types[i].first;
+        if (!table_entry.ColumnExists(column_name)) {
+            throw InvalidInputException("null_probability refers to unknown column \"%s\"", column_name);
+        }
+        result[column_name] = GeneratorFunctionData::ParseNullProbability(children[i]);
+    }
+    return result;
+}
+
+ListLengths get_list_lengths(TableFunctionBindInput& input) {
+    uint64_t min_length = ListLengths().min;
+    uint64_t max_length = ListLengths().max;
+    if (input.named_parameters.contains("min_list_length")) {
+        min_length = input.named_parameters["min_list_length"].GetValue<uint64_t>();
+        // Keep the default range if only the minimum is raised above it
+        max_length = std::max(max_length, min_length);
+    }
+    if (input.named_parameters.contains("max_list_length")) {
+        max_length = input.named_parameters["max_list_length"].GetValue<uint64_t>();
+    }
+
+    if (min_length > max_length) {
+        throw InvalidInputException("min_list_length must be less than or equal to max_list_length");
+    }
+    if (max_length > ListColumnGenerator::MAX_LENGTH) {
+        throw InvalidInputException("max_list_length must be less than or equal to %llu",
+                                    ListColumnGenerator::MAX_LENGTH);
+    }
+    return {static_cast<uint32_t>(min_length), static_cast<uint32_t>(max_length)};
+}
+
+// A column of a foreign key and the column of the referenced table it refers to
+struct ForeignKeyReference {
+    string schema;
+    string table;
+    string column;
+    // Whether the foreign key refers to its own table
+    bool is_self_reference;
+    // Logical index of the first column of the foreign key, which keys the sampling of the referenced rows
+    idx_t key_idx;
+};
+
+struct ColumnConstraints {
+    // Logical indexes of the columns whose values must not repeat
+    unordered_set<idx_t> unique_columns;
+    // Logical indexes of the columns that must not contain NULLs
+    unordered_set<idx_t> not_null_columns;
+    // Foreign key references by the logical index of the referencing column
+    unordered_map<idx_t, ForeignKeyReference> foreign_keys;
+};
+
+// Picks the column that makes a compound key unique: the first one that can hold num_rows distinct values itself.
+// Foreign keys are only unique if their table has at most as many rows as the referenced one, so they come last.
+idx_t choose_unique_column(const TableCatalogEntry& table_entry, const ColumnConstraints& constraints,
+                           const vector<idx_t>& indexes, const uint64_t num_rows) {
+    for (const idx_t index : indexes) {
+        const auto& col = table_entry.GetColumn(LogicalIndex(index));
+        if (!constraints.foreign_keys.contains(index) && SupportsUniqueValues(col.Type(), num_rows)) {
+            return index;
+        }
+    }
+    return indexes.front();
+}
+
+// Uniqueness is planned for a table with num_rows rows
+ColumnConstraints get_column_constraints(const TableCatalogEntry& table_entry, const uint64_t num_rows) {
+    ColumnConstraints result;
+    vector<vector<idx_t>> compound_keys;
+    for (const auto& constraint : table_entry.GetConstraints()) {
+        switch (constraint->type) {
+        case ConstraintType::NOT_NULL:
+            result.not_null_columns.insert(constraint->Cast<NotNullConstraint>().index.index);
+            break;
+        case ConstraintType::UNIQUE: {
+            const auto& unique = constraint->Cast<UniqueConstraint>();
+            vector<idx_t> indexes;
+            if (unique.HasIndex()) {
+                indexes.push_back(unique.GetIndex().index);
+            } else {
+                for (const auto& column_name : unique.GetColumnNames()) {
+                    indexes.push_back(table_entry.GetColumn(column_name).Logical().index);
+                }
+            }
+            if (unique.IsPrimaryKey()) {
+                result.not_null_columns.insert(indexes.begin(), indexes.end());
+            }
+            if (indexes.size() == 1) {
+                result.unique_columns.insert(indexes.front());
+            } else {
+                compound_keys.push_back(std::move(indexes));
+            }
+            break;
+        }
+        case ConstraintType::FOREIGN_KEY: {
+            const auto& foreign_key = constraint->Cast<ForeignKeyConstraint>();
+            // The referenced table also records the foreign key, but that does not restrict its own values
+            if (foreign_key.info.type == ForeignKeyType::FK_TYPE_PRIMARY_KEY_TABLE) {
+                break;
+            }
+            D_ASSERT(foreign_key.fk_columns.size() == foreign_key.pk_columns.size());
+            const idx_t key_idx = table_entry.GetColumn(foreign_key.fk_columns.front()).Logical().index;
+            for (idx_t i = 0; i < foreign_key.fk_columns.size(); i++) {
+                const idx_t column_idx = table_entry.GetColumn(foreign_key.fk_columns[i]).Logical().index;
+                // A column of several foreign keys only follows the first of them
+                result.foreign_keys.emplace(
+                    column_idx,
+                    ForeignKeyReference{foreign_key.info.schema,
+                                        foreign_key.info.table,
+                                        foreign_key.pk_columns[i],
+                                        foreign_key.info.type == ForeignKeyType::FK_TYPE_SELF_REFERENCE_TABLE,
+                                        key_idx});
+            }
+            break;
+        }
+        case ConstraintType::CHECK:
+            throw NotImplementedException("Tables with CHECK constraints are not supported as schema_source yet");
+        default:
+            throw InternalException("Unsupported constraint type");
+        }
+    }
+    // If one column of a compound key is unique, so is the combination of all its columns
+    for (const auto& indexes : compound_keys) {
+        const bool has_unique_column = std::any_of(indexes.begin(), indexes.end(), [&](const idx_t index) {
+            return result.unique_columns.contains(index);
+        });
+        if (!has_unique_column) {
+            result.unique_columns.insert(choose_unique_column(table_entry, result, indexes, num_rows));
+        }
+    }
+    return result;
+}
+
+// Number of rows of the tables referenced by foreign keys
+struct ParentRows {
+    uint64_t default_rows = GeneratorFunctionData::DEFAULT_MAX_GENERATED_ROWS;
+    case_insensitive_map_t<uint64_t> rows_per_table;
+
+    uint64_t Get(const string& table_name) const {
+        const auto it = rows_per_table.find(table_name);
+        return it != rows_per_table.end() ? it->second : default_rows;
+    }
+};
+
+uint64_t parse_parent_rows(const Value& value) {
+    const uint64_t result = value.GetValue<uint64_t>();
+    if (result == 0 || result > GeneratorFunctionData::MAX_GENERATED_ROWS_LIMIT) {
+        throw InvalidInputException("parent_rows must be between 1 and 2^63");
+    }
+    return result;
+}
+
+ParentRows get_parent_rows(TableFunctionBindInput& input) {
+    ParentRows result;
+    const auto it = input.named_parameters.find("parent_rows");
+    if (it == input.named_parameters.end()) {
+        return result;
+    }
+    const Value& value = it->second;
+    if (value.type().id() != LogicalTypeId::STRUCT) {
+        result.default_rows = parse_parent_rows(value);
+        return result;
+    }
+    const auto& child_types = StructType::GetChildTypes(value.type());
+    const auto& children = StructValue::GetChildren(value);
+    for (idx_t i = 0; i < children.size(); i++) {
+        result.rows_per_table[child_types[i].first] = parse_parent_rows(children[i]);
+    }
+    return result;
+}
+
+// Settings that also apply to the tables referenced by foreign keys.
+// Foreign keys only refer to existing rows if the referenced tables were generated by random_data with the same seed
+// and list lengths, and with the number of rows given by parent_rows.
+struct GenerationSettings {
+    ClientContext& context;
+    uint64_t seed;
+    ListLengths list_lengths;
+    ParentRows parent_rows;
+};
+
+// Limits the chain of tables that is followed from a foreign key, which guards against cyclic references
+constexpr idx_t MAX_FOREIGN_KEY_DEPTH = 16;
+
+unique_ptr<ColumnGenerator> create_column_generator(const GenerationSettings& settings,
+                                                    const TableCatalogEntry& table_entry,
+                                                    const ColumnConstraints& constraints, const ColumnDefinition& col,
+                                                    uint64_t num_rows, idx_t depth);
+
+unique_ptr<ColumnGenerator> create_foreign_key_generator(const GenerationSettings& settings,
+                                                         const TableCatalogEntry& table_entry,
+                                                         const ForeignKeyReference& reference,
+                                                         const ColumnDefinition& col, const bool is_unique,
+                                                         const uint64_t num_rows, const idx_t depth) {
+    if (depth >= MAX_FOREIGN_KEY_DEPTH) {
+        throw NotImplementedException("Foreign keys across more than %llu tables are not supported",
+                                      MAX_FOREIGN_KEY_DEPTH);
+    }
+
+    const TableCatalogEntry* parent_entry = &table_entry;
+    uint64_t parent_rows = num_rows;
+    if (!reference.is_self_reference) {
+        // Foreign keys can only refer to tables in the same catalog
+        const string& schema = reference.schema.empty() ? table_entry.ParentSchema().name : reference.schema;
+        auto& entry = Catalog::GetEntry(
+            settings.context, CatalogType::TABLE_ENTRY, table_entry.ParentCatalog().GetName(), schema, reference.table);
+        auto& parent_table = entry.Cast<TableCatalogEntry>();
+        parent_entry = &parent_table;
+        parent_rows = settings.parent_rows.Get(parent_entry->name);
+        if (parent_table.IsDuckTable()) {
+            // An empty table may still be generated later, but a filled one must contain all referenced rows
+            const idx_t existing_rows = parent_table.GetStorage().GetTotalRows();
+            if (existing_rows > 0 && existing_rows < parent_rows) {
+                throw InvalidInputException("Foreign keys reference %llu rows of table \"%s\", which only has %llu "
+                                            "rows. Pass its number of rows as parent_rows",
+                                            parent_rows,
+                                            parent_entry->name,
+                                            existing_rows);
+            }
+        }
+    }
+    if (parent_entry->HasGeneratedColumns()) {
+        throw NotImplementedException("Tables with generated columns are not supported as schema_source yet");
+    }
+
+    const auto& parent_col = parent_entry->GetColumn(reference.column);
+    if (parent_col.Type() != col.Type()) {
+        throw NotImplementedException("Foreign key column \"%s\" must have the same type as the column it references",
+                                      col.Name());
+    }
+    const ColumnConstraints parent_constraints = get_column_constraints(*parent_entry, parent_rows);
+    // The NULLs of a nullable column depend on the null_probability of the referenced table, which is unknown here
+    if (!parent_constraints.not_null_columns.contains(parent_col.Logical().index)) {
+        throw NotImplementedException("Foreign key column \"%s\" must reference a NOT NULL or PRIMARY KEY column",
+                                      col.Name());
+    }
+    auto parent_generator =
+        create_column_generator(settings, *parent_entry, parent_constraints, parent_col, parent_rows, depth + 1);
+
+    if (is_unique) {
+        // Taking the value of the referenced row with the same rowid keeps the values distinct
+        if (num_rows > parent_rows) {
+            throw InvalidInputException("Cannot generate %llu unique values for column \"%s\", which references "
+                                        "only %llu rows",
+                                        num_rows,
+                                        col.Name(),
+                                        parent_rows);
+        }
+        return parent_generator;
+    }
+    return make_uniq<ForeignKeyColumnGenerator>(
+        std::move(parent_generator), settings.seed, reference.key_idx, parent_rows);
+}
+
+// Creates the generator of a column of a table with num_rows rows
+unique_ptr<ColumnGenerator> create_column_generator(const GenerationSettings& settings,
+                                                    const TableCatalogEntry& table_entry,
+                                                    const ColumnConstraints& constraints, const ColumnDefinition& col,
+                                                    const uint64_t num_rows, const idx_t depth) {
+    // Every column gets its own RNG stream, keyed by the position of the column
+    const idx_t column_idx = col.Physical().index;
+    const bool is_unique = constraints.unique_columns.contains(col.Logical().index);
+    if (const auto it = constraints.foreign_keys.find(col.Logical().index); it != constraints.foreign_keys.end()) {
+        return create_foreign_key_generator(settings, table_entry, it->second, col, is_unique, num_rows, depth);
+    }
+    if (is_unique) {
+        // The rowids of every scan lie below num_rows, so all generated values are distinct
+        return CreateUniqueColumnGenerator(col.Type(), settings.seed, column_idx, num_rows);
+    }
+    return CreateDefaultColumnGenerator(col.Type(), settings.seed, column_idx, settings.list_lengths);
+}
+
+unique_ptr<FunctionData> RandomDataBind(ClientContext& context, TableFunctionBindInput& input,
+                                        vector<LogicalType>& return_types, vector<string>& names) {
+    auto& table_entry = get_schema_source(context, input);
 
     // TODO: What if the table has generated columns?
     if (table_entry.HasGeneratedColumns()) {
         throw NotImplementedException("Tables with generated columns are not supported as schema_source yet");
     }
-    // TODO: What about constraints?
-    if (table_entry.GetConstraints().size() > 0) {
-        throw NotImplementedException("Tables with constraints are not supported as schema_source yet");
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+    const ColumnConstraints column_constraints = get_column_constraints(table_entry, bind_data->max_generated_rows);
+    for (const auto& [column_idx, reference] : column_constraints.foreign_keys) {
+        // Without the seed of the referenced tables, the foreign keys would refer to values they do not contain
+        if (!reference.is_self_reference && !input.named_parameters.contains("seed")) {
+            throw InvalidInputException("Tables with FOREIGN KEY constraints require a seed, which must be the same "
+                                        "as for the referenced tables");
+        }
+    }
+    const auto column_null_probabilities = get_column_null_probabilities(table_entry, input);
+    const GenerationSettings settings{context, bind_data->seed, get_list_lengths(input), get_parent_rows(input)};
+    std::optional<vector<ColumnProfile>> profiles;
+    if (input.named_parameters.contains("profile") && input.named_parameters["profile"].GetValue<bool>()) {
+        profiles = ProfileTable(context, table_entry, bind_data->seed);
     }
+    const bool has_null_probability = input.named_parameters.contains("null_probability");
 
-    duckdb::vector<ColumnDefinition> produced_columns;
     for (const auto& col : table_entry.GetColumns().Physical()) {
         // TODO: What if the column has default values?
         if (col.HasDefaultValue()) {
             throw NotImplementedException("Tables with default values are not supported as schema_source yet");
         }
-        produced_columns.push_back(ColumnDefinition(col.Name(), col.Type()));
-    }
 
-    std::ostringstream subquery;
-    // SELECT tf1.value AS my_string, tf2.value AS my_int1, tf3.value AS my_int2
-    subquery << "SELECT ";
-    for (size_t i = 0; i < produced_columns.size(); i++) {
-        const auto& col = produced_columns[i];
-        subquery << "tf" << i << ".value AS " << col.Name();
-        if (i < produced_columns.size() - 1) {
-            subquery << ", ";
+        std::optional<double> column_null_probability;
+        if (const auto it = column_null_probabilities.find(col.Name()); it != column_null_probabilities.end()) {
+            column_null_probability = it->second;
+        } else if (!column_null_probabilities.empty()) {
+            // Columns that are missing from the struct get no NULLs
+            column_null_probability = 0.0;
         }
-    }
-    // FROM random_string() as tf1
-    // POSITIONAL JOIN random_int() as tf2
-    // POSITIONAL JOIN random_int() as tf3
-    subquery << " FROM ";
-    for (size_t i = 0; i < produced_columns.size(); i++) {
-        const auto& col = produced_columns[i];
-        std::string generator = logical_type_to_generator_name(col.Type());
-        subquery << generator << "() as tf" << i;
-        if (i < produced_columns.size() - 1) {
-            subquery << " POSITIONAL JOIN ";
+        if (profiles.has_value() && !has_null_probability) {
+            column_null_probability = profiles->at(col.Physical().index).null_fraction;
+        }
+        if (column_constraints.not_null_columns.contains(col.Logical().index)) {
+            column_null_probability = 0.0;
         }
-    }
 
-    Parser parser(context.GetParserOptions());
-    parser.ParseQuery(subquery.str());
-    auto select_stmt = unique_ptr_cast<SQLStatement, SelectStatement>(std::move(parser.statements[0]));
+        D_ASSERT(col.Physical().index == bind_data->columns.size());
+        unique_ptr<ColumnGenerator> generator;
+        // Keys keep their generators, so that they stay unique and refer to existing rows
+        if (profiles.has_value() && !column_constraints.unique_columns.contains(col.Logical().index) &&
+            !column_constraints.foreign_keys.contains(col.Logical().index)) {
+            const idx_t column_idx = col.Physical().index;
+            generator = CreateProfiledColumnGenerator(
+                col.Type(), settings.seed, column_idx, profiles->at(column_idx), settings.list_lengths);
+        } else {
+            generator = create_column_generator(
+                settings, table_entry, column_constraints, col, bind_data->max_generated_rows, 0);
+        }
+        bind_data->AddColumn(std::move(generator), column_null_probability);
 
-    return duckdb::make_uniq_base<TableRef, SubqueryRef>(std::move(select_stmt));
-}
+        names.push_back(col.Name());
+        return_types.push_back(bind_data->columns.back()->type);
+    }
 
-void RandomDataExecute(ClientContext&, TableFunctionInput&, DataChunk&) {
-    // The table function gets replaced with a subquery that calls other generators instead.
-    throw InternalException("RandomDataFunction should never be executed directly");
+    return bind_data;
 }
 } // anonymous namespace
 
 void RandomDataFunction::RegisterFunction(ExtensionLoader& loader) {
-    TableFunction random_data_function("random_data", {}, RandomDataExecute);
-    random_data_function.bind_replace = RandomDataBindReplace;
+    TableFunction random_data_function("random_data", {}, GeneratorExecute, RandomDataBind);
     random_data_function.named_parameters["schema_source"] = LogicalType::VARCHAR;
-    // TODO: Add support for rowid column and projection pushdown
+    // MAP values can be shorter than min_list_length, since entries with duplicate keys are removed
+    random_data_function.named_parameters["min_list_length"] = LogicalType::UBIGINT;
+    random_data_function.named_parameters["max_list_length"] = LogicalType::UBIGINT;
+    // Either a row count for all referenced tables or a struct with a row count per table
+    random_data_function.named_parameters["parent_rows"] = LogicalType::ANY;
+    // Samples the schema_source table and generates values that follow its distributions
+    random_data_function.named_parameters["profile"] = LogicalType::BOOLEAN;
+    ConfigureGeneratorFunction(random_data_function);
+    // Either a probability for all columns or a struct with a probability per column
+    random_data_function.named_parameters["null_probability"] = LogicalType::ANY;
     loader.RegisterFunction(random_data_function);
 }
 
@@ -0,0 +1,119 @@
+#include "row_ranges.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace duckdb_faker {
+
+RowRanges RowRanges::Range(const uint64_t start, const uint64_t end) {
+    RowRanges result;
+    if (start < end) {
+        result.ranges.push_back({start, end});
+    }
+    return result;
+}
+
+RowRanges RowRanges::FromRowIds(std::vector<uint64_t> rowids) {
+    std::sort(rowids.begin(), rowids.end());
+
+    RowRanges result;
+    for (const uint64_t rowid : rowids) {
+        if (!result.ranges.empty() && rowid <= result.ranges.back().end) {
+            // Duplicate or adjacent rowid
+            result.ranges.back().end = std::max(result.ranges.back().end, rowid + 1);
+        } else {
+            result.ranges.push_back({rowid, rowid + 1});
+        }
+    }
+    return result;
+}
+
+void RowRanges::Intersect(const RowRanges& other) {
+    std::vector<RowRange> intersection;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < ranges.size() && j < other.ranges.size()) {
+        const uint64_t start = std::max(ranges[i].start, other.ranges[j].start);
+        const uint64_t end = std::min(ranges[i].end, other.ranges[j].end);
+        if (start < end) {
+            intersection.push_back({start, end});
+        }
+        // Advance the range that ends first
+        if (ranges[i].end < other.ranges[j].end) {
+            i++;
+        } else {
+            j++;
+        }
+    }
+    ranges = std::move(intersection);
+}
+
+void RowRanges::Union(const RowRanges& other) {
+    std::vector<RowRange> all_ranges;
+    all_ranges.reserve(ranges.size() + other.ranges.size());
+    std::merge(ranges.cbegin(),
+               ranges.cend(),
+               other.ranges.cbegin(),
+               other.ranges.cend(),
+               std::back_inserter(all_ranges),
+               [](const RowRange& lhs, const RowRange& rhs) { return lhs.start < rhs.start; });
+
+    // Merge overlapping and adjacent ranges
+    std::vector<RowRange> merged;
+    for (const auto& range : all_ranges) {
+        if (!merged.empty() && range.start <= merged.back().end) {
+            merged.back().end = std::max(merged.back().end, range.end);
+        } else {
+            merged.push_back(range);
+        }
+    }
+    ranges = std::move(merged);
+}
+
+void RowRanges::Skip(uint64_t count) {
+    size_t num_skipped_ranges = 0;
+    for (auto& range : ranges) {
+        const uint64_t range_size = range.end - range.start;
+        if (count < range_size) {
+            range.start += count;
+            break;
+        }
+        count -= range_size;
+        num_skipped_ranges++;
+    }
+    ranges.erase(ranges.begin(), ranges.begin() + static_cast<std::ptrdiff_t>(num_skipped_ranges));
+}
+
+void RowRanges::Truncate(uint64_t count) {
+    size_t num_kept_ranges = 0;
+    for (auto& range : ranges) {
+        if (count == 0) {
+            break;
+        }
+        const uint64_t range_size = range.end - range.start;
+        if (count < range_size) {
+            range.end = range.start + count;
+        }
+        count -= std::min(count, range_size);
+        num_kept_ranges++;
+    }
+    ranges.resize(num_kept_ranges);
+}
+
+uint64_t RowRanges::Count() const {
+    uint64_t count = 0;
+    for (const auto& range : ranges) {
+        count += range.end - range.start;
+    }
+    return count;
+}
+
+const std::vector<RowRange>& RowRanges::Ranges() const {
+    return ranges;
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace duckdb_faker {
+
+// Half-open range of rowids [start, end)
+struct RowRange {
+    uint64_t start;
+    uint64_t end;
+};
+
+// Set of rowids, stored as sorted, disjoint and non-empty ranges
+class RowRanges {
+public:
+    RowRanges() = default;
+
+    // Contains all rowids in [start, end)
+    static RowRanges Range(uint64_t start, uint64_t end);
+    // Contains exactly the given rowids
+    static RowRanges FromRowIds(std::vector<uint64_t> rowids);
+
+    void Intersect(const RowRanges& other);
+    void Union(const RowRanges& other);
+    // Removes the first count rowids
+    void Skip(uint64_t count);
+    // Keeps at most the first count rowids
+    void Truncate(uint64_t count);
+
+    // Number of rowids in the set
+    uint64_t Count() const;
+    const std::vector<RowRange>& Ranges() const;
+
+private:
+    std::vector<RowRange> ranges;
+};
+
+} // namespace duckdb_faker
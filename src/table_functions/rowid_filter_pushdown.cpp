@@ -0,0 +1,182 @@
+#include "rowid_filter_pushdown.hpp"
+
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/expression.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "generator_function_data.hpp"
+#include "row_ranges.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Exclusive upper bound of all rowids
+constexpr uint64_t ROWID_END = GeneratorFunctionData::MAX_GENERATED_ROWS_LIMIT;
+
+bool is_rowid_column(const LogicalGet& get, const Expression& expr) {
+    if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+        return false;
+    }
+    const auto& column_ref = expr.Cast<BoundColumnRefExpression>();
+    if (column_ref.binding.table_index != get.table_index) {
+        return false;
+    }
+    const auto& column_ids = get.GetColumnIds();
+    return column_ref.binding.column_index < column_ids.size() &&
+           column_ids[column_ref.binding.column_index].IsRowIdColumn();
+}
+
+// Returns the value of a non-NULL BIGINT constant, which is what rowids are compared with
+std::optional<int64_t> get_rowid_constant(const Expression& expr) {
+    if (expr.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+        return std::nullopt;
+    }
+    const auto& value = expr.Cast<BoundConstantExpression>().value;
+    if (value.IsNull() || value.type().id() != LogicalTypeId::BIGINT) {
+        return std::nullopt;
+    }
+    return value.GetValue<int64_t>();
+}
+
+// Returns the rowids that satisfy "rowid <comparison> constant"
+std::optional<RowRanges> comparison_to_ranges(const ExpressionType comparison, const int64_t constant) {
+    const bool is_negative = constant < 0;
+    const uint64_t value = is_negative ? 0 : static_cast<uint64_t>(constant);
+
+    switch (comparison) {
+    case ExpressionType::COMPARE_EQUAL:
+        return is_negative ? RowRanges() : RowRanges::Range(value, value + 1);
+    case ExpressionType::COMPARE_NOTEQUAL: {
+        if (is_negative) {
+            return RowRanges::Range(0, ROWID_END);
+        }
+        auto ranges = RowRanges::Range(0, value);
+        ranges.Union(RowRanges::Range(value + 1, ROWID_END));
+        return ranges;
+    }
+    case ExpressionType::COMPARE_LESSTHAN:
+        return RowRanges::Range(0, value);
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+        return is_negative ? RowRanges() : RowRanges::Range(0, value + 1);
+    case ExpressionType::COMPARE_GREATERTHAN:
+        return is_negative ? RowRanges::Range(0, ROWID_END) : RowRanges::Range(value + 1, ROWID_END);
+    case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+        return RowRanges::Range(value, ROWID_END);
+    default:
+        return std::nullopt;
+    }
+}
+
+// Returns a superset of the rowids that satisfy the filter, or nullopt if the filter does not restrict the rowids
+std::optional<RowRanges> filter_to_ranges(const LogicalGet& get, const Expression& filter) {
+    switch (filter.GetExpressionClass()) {
+    case ExpressionClass::BOUND_COMPARISON: {
+        const auto& comparison = filter.Cast<BoundComparisonExpression>();
+        if (is_rowid_column(get, *comparison.left)) {
+            const auto constant = get_rowid_constant(*comparison.right);
+            if (constant.has_value()) {
+                return comparison_to_ranges(comparison.GetExpressionType(), constant.value());
+            }
+        } else if (is_rowid_column(get, *comparison.right)) {
+            const auto constant = get_rowid_constant(*comparison.left);
+            if (constant.has_value()) {
+                return comparison_to_ranges(FlipComparisonExpression(comparison.GetExpressionType()), constant.value());
+            }
+        }
+        return std::nullopt;
+    }
+    case ExpressionClass::BOUND_BETWEEN: {
+        const auto& between = filter.Cast<BoundBetweenExpression>();
+        if (!is_rowid_column(get, *between.input)) {
+            return std::nullopt;
+        }
+        const auto lower = get_rowid_constant(*between.lower);
+        const auto upper = get_rowid_constant(*between.upper);
+        if (!lower.has_value() || !upper.has_value()) {
+            return std::nullopt;
+        }
+        const auto lower_comparison = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+                                                              : ExpressionType::COMPARE_GREATERTHAN;
+        const auto upper_comparison =
+            between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+        auto ranges = comparison_to_ranges(lower_comparison, lower.value()).value();
+        ranges.Intersect(comparison_to_ranges(upper_comparison, upper.value()).value());
+        return ranges;
+    }
+    case ExpressionClass::BOUND_OPERATOR: {
+        if (filter.GetExpressionType() != ExpressionType::COMPARE_IN) {
+            return std::nullopt;
+        }
+        const auto& in_list = filter.Cast<BoundOperatorExpression>();
+        if (!is_rowid_column(get, *in_list.children[0])) {
+            return std::nullopt;
+        }
+        std::vector<uint64_t> rowids;
+        for (idx_t i = 1; i < in_list.children.size(); i++) {
+            const auto constant = get_rowid_constant(*in_list.children[i]);
+            if (!constant.has_value()) {
+                return std::nullopt;
+            }
+            // Negative rowids never match
+            if (constant.value() >= 0) {
+                rowids.push_back(static_cast<uint64_t>(constant.value()));
+            }
+        }
+        return RowRanges::FromRowIds(std::move(rowids));
+    }
+    case ExpressionClass::BOUND_CONJUNCTION: {
+        const auto& conjunction = filter.Cast<BoundConjunctionExpression>();
+        const bool is_and = conjunction.GetExpressionType() == ExpressionType::CONJUNCTION_AND;
+        std::optional<RowRanges> ranges;
+        for (const auto& child : conjunction.children) {
+            const auto child_ranges = filter_to_ranges(get, *child);
+            if (!child_ranges.has_value()) {
+                if (is_and) {
+                    // A child that does not restrict the rowids can be ignored in a conjunction
+                    continue;
+                }
+                // ... but in a disjunction, it can match any rowid
+                return std::nullopt;
+            }
+            if (!ranges.has_value()) {
+                ranges = child_ranges;
+            } else if (is_and) {
+                ranges->Intersect(child_ranges.value());
+            } else {
+                ranges->Union(child_ranges.value());
+            }
+        }
+        return ranges;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+} // namespace
+
+void PushdownRowIdFilters(ClientContext&, LogicalGet& get, FunctionData* bind_data,
+                          vector<unique_ptr<Expression>>& filters) {
+    auto& generator_bind_data = bind_data->Cast<GeneratorFunctionData>();
+    for (const auto& filter : filters) {
+        const auto ranges = filter_to_ranges(get, *filter);
+        if (ranges.has_value()) {
+            generator_bind_data.row_ranges.Intersect(ranges.value());
+        }
+    }
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "utils/client_context_decl.hpp"
+
+namespace duckdb {
+class Expression;
+class LogicalGet;
+struct FunctionData;
+} // namespace duckdb
+
+namespace duckdb_faker {
+
+// Restricts the generated rows to those that can satisfy the filters on the virtual 'rowid' column.
+// The filters themselves stay in the plan and are still evaluated on the generated rows.
+void PushdownRowIdFilters(duckdb::ClientContext& context, duckdb::LogicalGet& get, duckdb::FunctionData* bind_data,
+                          duckdb::vector<duckdb::unique_ptr<duckdb::Expression>>& filters);
+
+} // namespace duckdb_faker
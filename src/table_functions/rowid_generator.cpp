@@ -38,7 +38,8 @@ void PopulateRowIdColumn(const uint64_t start_rowid, const optional_idx rowid_co
     D_ASSERT(LogicalType(LogicalType::ROW_TYPE).InternalType() == duckdb::GetTypeId<int64_t>());
     D_ASSERT(rowid_vector.GetVectorType() == VectorType::FLAT_VECTOR);
 
-    if (cardinality > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) - start_rowid) {
+    // The last rowid of the chunk is start_rowid + cardinality - 1
+    if (cardinality > 0 && cardinality - 1 > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) - start_rowid) {
         throw InvalidInputException("Row ID overflow: cannot generate row IDs beyond INT64_MAX");
     }
 
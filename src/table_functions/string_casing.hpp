@@ -1,5 +1,7 @@
+#pragma once
+
 #include <optional>
-#include <stdexcept>
+#include <string>
 
 namespace duckdb_faker {
 enum class StringCasing {
@@ -8,7 +10,7 @@ enum class StringCasing {
     Mixed
 };
 
-std::optional<StringCasing> string_casing_from_string(const std::string& casing) {
+inline std::optional<StringCasing> string_casing_from_string(const std::string& casing) {
     if (casing == "lower") {
         return StringCasing::Lower;
     } else if (casing == "upper") {
@@ -20,17 +22,4 @@ std::optional<StringCasing> string_casing_from_string(const std::string& casing)
     }
 }
 
-faker::string::StringCasing to_faker_casing(const StringCasing casing) {
-    switch (casing) {
-    case StringCasing::Lower:
-        return faker::string::StringCasing::Lower;
-    case StringCasing::Upper:
-        return faker::string::StringCasing::Upper;
-    case StringCasing::Mixed:
-        return faker::string::StringCasing::Mixed;
-    }
-    // Should never happen
-    throw std::runtime_error("Invalid string casing");
-}
-
 } // namespace duckdb_faker
\ No newline at end of file
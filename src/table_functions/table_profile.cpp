@@ -0,0 +1,211 @@
+#include "table_profile.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_index.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "rng/counter_rng.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+constexpr uint64_t SAMPLE_ROWS = 16384;
+constexpr uint64_t HISTOGRAM_BUCKETS = 32;
+constexpr idx_t MAX_FREQUENT_VALUES = 32;
+// Separates the sampled rows from the values generated with the same seed
+constexpr uint64_t SAMPLE_SEED_KEY = 0x5BE0CD19137E2179ULL;
+
+// Returns the number that the histogram of the column describes
+double histogram_value(const Value& value) {
+    switch (value.type().InternalType()) {
+    case PhysicalType::INT8:
+        return value.GetValueUnsafe<int8_t>();
+    case PhysicalType::INT16:
+        return value.GetValueUnsafe<int16_t>();
+    case PhysicalType::INT32:
+        return value.GetValueUnsafe<int32_t>();
+    case PhysicalType::INT64:
+        return static_cast<double>(value.GetValueUnsafe<int64_t>());
+    case PhysicalType::UINT8:
+        return value.GetValueUnsafe<uint8_t>();
+    case PhysicalType::UINT16:
+        return value.GetValueUnsafe<uint16_t>();
+    case PhysicalType::UINT32:
+        return value.GetValueUnsafe<uint32_t>();
+    case PhysicalType::UINT64:
+        return static_cast<double>(value.GetValueUnsafe<uint64_t>());
+    case PhysicalType::FLOAT:
+        return value.GetValueUnsafe<float>();
+    case PhysicalType::DOUBLE:
+        return value.GetValueUnsafe<double>();
+    case PhysicalType::VARCHAR:
+        return static_cast<double>(StringValue::Get(value).size());
+    default:
+        throw InternalException("Unsupported physical type for histograms: %s",
+                                TypeIdToString(value.type().InternalType()));
+    }
+}
+
+// Picks the values at equally spaced ranks, so that each bucket holds the same number of values
+std::vector<double> equi_depth_boundaries(std::vector<double>& values) {
+    std::sort(values.begin(), values.end());
+    const uint64_t num_buckets = std::min<uint64_t>(HISTOGRAM_BUCKETS, values.size() - 1);
+    std::vector<double> boundaries(num_buckets + 1);
+    for (uint64_t i = 0; i <= num_buckets; i++) {
+        boundaries[i] = values[num_buckets == 0 ? 0 : i * (values.size() - 1) / num_buckets];
+    }
+    return boundaries;
+}
+
+ColumnProfile build_column_profile(const LogicalType& type, const vector<Value>& values, const idx_t num_rows) {
+    ColumnProfile profile;
+    if (num_rows == 0) {
+        return profile;
+    }
+    profile.null_fraction = static_cast<double>(num_rows - values.size()) / static_cast<double>(num_rows);
+    if (values.empty()) {
+        return profile;
+    }
+
+    value_map_t<idx_t> counts;
+    for (const auto& value : values) {
+        counts[value]++;
+    }
+    vector<std::pair<Value, idx_t>> frequent;
+    for (const auto& [value, count] : counts) {
+        if (count > 1) {
+            frequent.emplace_back(value, count);
+        }
+    }
+    // Ties are broken by the value, so that the profile does not depend on the order of the sample
+    std::sort(frequent.begin(), frequent.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    if (frequent.size() > MAX_FREQUENT_VALUES) {
+        frequent.resize(MAX_FREQUENT_VALUES);
+    }
+
+    value_set_t frequent_set;
+    for (const auto& [value, count] : frequent) {
+        profile.frequent_values.push_back(value);
+        profile.frequencies.push_back(static_cast<double>(count) / static_cast<double>(values.size()));
+        frequent_set.insert(value);
+    }
+
+    std::vector<double> other_values;
+    for (const auto& value : values) {
+        if (frequent_set.find(value) == frequent_set.end()) {
+            profile.has_other_values = true;
+            if (ColumnProfile::SupportsHistogram(type)) {
+                other_values.push_back(histogram_value(value));
+            }
+        }
+    }
+    if (!other_values.empty()) {
+        profile.boundaries = equi_depth_boundaries(other_values);
+    }
+    return profile;
+}
+} // namespace
+
+bool ColumnProfile::SupportsHistogram(const LogicalType& type) {
+    switch (type.id()) {
+    case LogicalTypeId::TINYINT:
+    case LogicalTypeId::SMALLINT:
+    case LogicalTypeId::INTEGER:
+    case LogicalTypeId::BIGINT:
+    case LogicalTypeId::UTINYINT:
+    case LogicalTypeId::USMALLINT:
+    case LogicalTypeId::UINTEGER:
+    case LogicalTypeId::UBIGINT:
+    case LogicalTypeId::FLOAT:
+    case LogicalTypeId::DOUBLE:
+    case LogicalTypeId::DATE:
+    case LogicalTypeId::TIME:
+    case LogicalTypeId::TIMESTAMP:
+    case LogicalTypeId::TIMESTAMP_TZ:
+    case LogicalTypeId::TIMESTAMP_SEC:
+    case LogicalTypeId::TIMESTAMP_MS:
+    case LogicalTypeId::TIMESTAMP_NS:
+    case LogicalTypeId::VARCHAR:
+        return true;
+    case LogicalTypeId::DECIMAL:
+        // Doubles cannot interpolate between 128-bit values
+        return type.InternalType() != PhysicalType::INT128;
+    default:
+        return false;
+    }
+}
+
+vector<ColumnProfile> ProfileTable(ClientContext& context, TableCatalogEntry& table_entry, const uint64_t seed) {
+    if (!table_entry.IsDuckTable()) {
+        throw NotImplementedException("profile is only supported for tables stored in DuckDB");
+    }
+
+    vector<LogicalType> types;
+    vector<StorageIndex> column_ids;
+    for (const auto& col : table_entry.GetColumns().Physical()) {
+        types.push_back(col.Type());
+        column_ids.emplace_back(col.StorageOid());
+    }
+
+    // The scan runs in the transaction of the binder, so it sees temporary tables and uncommitted changes
+    auto& storage = table_entry.GetStorage();
+    auto& transaction = DuckTransaction::Get(context, table_entry.ParentCatalog());
+    TableScanState state;
+    storage.InitializeScan(context, transaction, state, column_ids);
+    DataChunk chunk;
+    chunk.Initialize(context, types);
+
+    // Reservoir sampling, where row i replaces a random sampled row with probability SAMPLE_ROWS / (i + 1)
+    const CounterRng rng(seed ^ SAMPLE_SEED_KEY, 0);
+    vector<vector<Value>> sample;
+    uint64_t num_scanned = 0;
+    while (true) {
+        chunk.Reset();
+        storage.Scan(transaction, chunk, state);
+        if (chunk.size() == 0) {
+            break;
+        }
+        for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++, num_scanned++) {
+            uint64_t slot = num_scanned;
+            if (num_scanned >= SAMPLE_ROWS) {
+                slot = BoundedUint64(rng.Word(num_scanned), num_scanned + 1);
+                if (slot >= SAMPLE_ROWS) {
+                    continue;
+                }
+            } else {
+                sample.emplace_back(types.size());
+            }
+            for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+                sample[slot][col_idx] = chunk.GetValue(col_idx, row_idx);
+            }
+        }
+    }
+
+    vector<ColumnProfile> profiles;
+    for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+        vector<Value> values;
+        for (const auto& row : sample) {
+            if (!row[col_idx].IsNull()) {
+                values.push_back(row[col_idx]);
+            }
+        }
+        profiles.push_back(build_column_profile(types[col_idx], values, sample.size()));
+    }
+    return profiles;
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/vector.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace duckdb {
+class TableCatalogEntry;
+}
+
+namespace duckdb_faker {
+
+// Summary of the values of a column, built from a sample of its table
+struct ColumnProfile {
+    // Fraction of the sampled rows that are NULL
+    double null_fraction = 0;
+    // The most common values that occur more than once in the sample, with their fractions of the non-NULL rows
+    duckdb::vector<duckdb::Value> frequent_values;
+    std::vector<double> frequencies;
+    // Whether the sample contains non-NULL values besides the frequent ones
+    bool has_other_values = false;
+    // Boundaries of an equi-depth histogram of the other values, or of their lengths for strings.
+    // Numbers are given by their physical value, for example days since the epoch for DATE.
+    // Empty if the type has no histogram.
+    std::vector<double> boundaries;
+
+    // Whether the values of the type can be described by a histogram
+    static bool SupportsHistogram(const duckdb::LogicalType& type);
+};
+
+// Samples the table once and builds the profiles of its physical columns.
+// The table is scanned in the current transaction of the context, and the sample only depends on the seed.
+duckdb::vector<ColumnProfile> ProfileTable(duckdb::ClientContext& context, duckdb::TableCatalogEntry& table_entry,
+                                           uint64_t seed);
+
+} // namespace duckdb_faker
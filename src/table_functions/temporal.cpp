@@ -0,0 +1,189 @@
+#include "temporal.hpp"
+
+#include "column_generators/int_column_generator.hpp"
+#include "column_generators/interval_column_generator.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/function/function.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
+#include "probability_distributions.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+// Reads the min and max parameters, falling back to the given defaults
+template <typename T>
+void bind_range(TableFunctionBindInput& input, T& min, T& max) {
+    if (input.named_parameters.contains("min")) {
+        min = input.named_parameters["min"].GetValue<T>();
+    }
+    if (input.named_parameters.contains("max")) {
+        max = input.named_parameters["max"].GetValue<T>();
+    }
+}
+
+// Dates and timestamps are generated as integers over their internal representation since the epoch,
+// so there is no calendar arithmetic per row
+unique_ptr<FunctionData> RandomDateBind(ClientContext& context, TableFunctionBindInput& input,
+                                        vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    date_t min = TemporalDefaults::MinDate();
+    date_t max = TemporalDefaults::MaxDate();
+    bind_range(input, min, max);
+    if (!Date::IsFinite(min) || !Date::IsFinite(max)) {
+        throw InvalidInputException("Minimum and maximum value must be finite dates");
+    }
+    if (min > max) {
+        throw InvalidInputException("Minimum value must be less than or equal to maximum value");
+    }
+
+    bind_data->AddColumn(make_uniq<IntColumnGenerator<int32_t>>(
+        LogicalType::DATE, bind_data->seed, 0, min.days, max.days, ProbabilityDistribution::Type::UNIFORM));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+
+unique_ptr<FunctionData> RandomTimeBind(ClientContext& context, TableFunctionBindInput& input,
+                                        vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    dtime_t min = TemporalDefaults::MinTime();
+    dtime_t max = TemporalDefaults::MaxTime();
+    bind_range(input, min, max);
+    if (min > max) {
+        throw InvalidInputException("Minimum value must be less than or equal to maximum value");
+    }
+
+    bind_data->AddColumn(make_uniq<IntColumnGenerator<int64_t>>(
+        LogicalType::TIME, bind_data->seed, 0, min.micros, max.micros, ProbabilityDistribution::Type::UNIFORM));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+
+unique_ptr<FunctionData> RandomTimestampBind(ClientContext& context, TableFunctionBindInput& input,
+                                             vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    timestamp_t min = TemporalDefaults::MinTimestamp();
+    timestamp_t max = TemporalDefaults::MaxTimestamp();
+    bind_range(input, min, max);
+    if (!Timestamp::IsFinite(min) || !Timestamp::IsFinite(max)) {
+        throw InvalidInputException("Minimum and maximum value must be finite timestamps");
+    }
+    if (min > max) {
+        throw InvalidInputException("Minimum value must be less than or equal to maximum value");
+    }
+
+    bind_data->AddColumn(make_uniq<IntColumnGenerator<int64_t>>(
+        LogicalType::TIMESTAMP, bind_data->seed, 0, min.value, max.value, ProbabilityDistribution::Type::UNIFORM));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+
+unique_ptr<FunctionData> RandomIntervalBind(ClientContext& context, TableFunctionBindInput& input,
+                                            vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    interval_t min = TemporalDefaults::MinInterval();
+    interval_t max = TemporalDefaults::MaxInterval();
+    bind_range(input, min, max);
+    if (min.months > max.months || min.days > max.days || min.micros > max.micros) {
+        throw InvalidInputException(
+            "Months, days and microseconds of the minimum value must be less than or equal to those of the maximum");
+    }
+
+    bind_data->AddColumn(make_uniq<IntervalColumnGenerator>(bind_data->seed, 0, min, max));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+
+void register_temporal_function(ExtensionLoader& loader, const string& name, const LogicalType& type,
+                                const table_function_bind_t bind) {
+    TableFunction function(name, {}, GeneratorExecute, bind);
+    function.named_parameters["min"] = type;
+    function.named_parameters["max"] = type;
+    ConfigureGeneratorFunction(function);
+    loader.RegisterFunction(function);
+}
+} // anonymous namespace
+
+void RandomDateFunction::RegisterFunction(ExtensionLoader& loader) {
+    register_temporal_function(loader, "random_date", LogicalType::DATE, RandomDateBind);
+}
+
+void RandomTimeFunction::RegisterFunction(ExtensionLoader& loader) {
+    register_temporal_function(loader, "random_time", LogicalType::TIME, RandomTimeBind);
+}
+
+void RandomTimestampFunction::RegisterFunction(ExtensionLoader& loader) {
+    register_temporal_function(loader, "random_timestamp", LogicalType::TIMESTAMP, RandomTimestampBind);
+}
+
+void RandomIntervalFunction::RegisterFunction(ExtensionLoader& loader) {
+    register_temporal_function(loader, "random_interval", LogicalType::INTERVAL, RandomIntervalBind);
+}
+
+date_t TemporalDefaults::MinDate() {
+    return Date::FromDate(1970, 1, 1);
+}
+
+date_t TemporalDefaults::MaxDate() {
+    return Date::FromDate(2037, 12, 31);
+}
+
+dtime_t TemporalDefaults::MinTime() {
+    return dtime_t(0);
+}
+
+dtime_t TemporalDefaults::MaxTime() {
+    return dtime_t(Interval::MICROS_PER_DAY - 1);
+}
+
+timestamp_t TemporalDefaults::MinTimestamp() {
+    return Timestamp::FromDatetime(MinDate(), MinTime());
+}
+
+timestamp_t TemporalDefaults::MaxTimestamp() {
+    return Timestamp::FromDatetime(MaxDate(), MaxTime());
+}
+
+interval_t TemporalDefaults::MinInterval() {
+    return interval_t {0, 0, 0};
+}
+
+interval_t TemporalDefaults::MaxInterval() {
+    return interval_t {Interval::MONTHS_PER_YEAR - 1, 30, Interval::MICROS_PER_DAY - 1};
+}
+
+} // namespace duckdb_faker
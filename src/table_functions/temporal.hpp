@@ -0,0 +1,42 @@
+#pragma once
+
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "utils/extension_loader_decl.hpp"
+
+namespace duckdb_faker {
+
+struct RandomDateFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+struct RandomTimeFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+struct RandomTimestampFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+struct RandomIntervalFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+// Ranges used if no bounds are given, also by random_data
+struct TemporalDefaults {
+    // 1970-01-01 to 2037-12-31
+    static duckdb::date_t MinDate();
+    static duckdb::date_t MaxDate();
+    // 00:00:00 to 23:59:59.999999
+    static duckdb::dtime_t MinTime();
+    static duckdb::dtime_t MaxTime();
+    // 1970-01-01 00:00:00 to 2037-12-31 23:59:59.999999
+    static duckdb::timestamp_t MinTimestamp();
+    static duckdb::timestamp_t MaxTimestamp();
+    // 0 to 11 months, 30 days and 23:59:59.999999
+    static duckdb::interval_t MinInterval();
+    static duckdb::interval_t MaxInterval();
+};
+
+} // namespace duckdb_faker
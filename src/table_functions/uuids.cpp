@@ -0,0 +1,58 @@
+#include "uuids.hpp"
+
+#include "column_generators/uuid_column_generator.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/function/function.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "generator_function.hpp"
+#include "generator_function_data.hpp"
+#include "utils/client_context_decl.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace duckdb;
+
+namespace duckdb_faker {
+
+namespace {
+unique_ptr<FunctionData> RandomUuidBind(ClientContext& context, TableFunctionBindInput& input,
+                                        vector<LogicalType>& return_types, vector<string>& names) {
+    auto bind_data = make_uniq<GeneratorFunctionData>();
+    bind_data->BindCommonParameters(context, input);
+
+    int32_t version = 4;
+    if (input.named_parameters.contains("version")) {
+        version = input.named_parameters["version"].GetValue<int32_t>();
+
+        if (!UuidColumnGenerator::IsSupportedVersion(version)) {
+            throw InvalidInputException("version must be 4 or 7");
+        }
+    }
+    // Later rows would wrap around the timestamp, so the UUIDs would no longer increase with the rowid
+    if (version == 7 && bind_data->max_generated_rows > UuidColumnGenerator::MaxVersion7Rows()) {
+        throw InvalidInputException("Version 7 UUIDs can be generated for at most %llu rows",
+                                    UuidColumnGenerator::MaxVersion7Rows());
+    }
+
+    bind_data->AddColumn(make_uniq<UuidColumnGenerator>(bind_data->seed, 0, static_cast<uint8_t>(version)));
+
+    names.push_back("value");
+    return_types.push_back(bind_data->columns.back()->type);
+
+    return bind_data;
+}
+} // anonymous namespace
+
+void RandomUuidFunction::RegisterFunction(ExtensionLoader& loader) {
+    TableFunction random_uuid_function("random_uuid", {}, GeneratorExecute, RandomUuidBind);
+    random_uuid_function.named_parameters["version"] = LogicalType::INTEGER;
+    ConfigureGeneratorFunction(random_uuid_function);
+    loader.RegisterFunction(random_uuid_function);
+}
+
+} // namespace duckdb_faker
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "utils/extension_loader_decl.hpp"
+
+namespace duckdb_faker {
+
+struct RandomUuidFunction {
+    static void RegisterFunction(duckdb::ExtensionLoader& loader);
+};
+
+} // namespace duckdb_faker
@@ -7,6 +7,7 @@
 #include "faker_extension.hpp"
 #include "test_helpers/database_fixture.hpp"
 
+#include <cmath>
 #include <cstdint>
 
 using duckdb_faker::test_helpers::DatabaseFixture;
@@ -108,4 +109,26 @@ TEST_CASE_METHOD(DatabaseFixture, "random_bool", "[booleans]") {
 
         CHECK((true_count >= expected_min_true_count && true_count <= expected_max_true_count));
     }
-}
\ No newline at end of file
+
+    SECTION("Should generate independent values for consecutive rows") {
+        const double true_probability = GENERATE(0.25, 0.5);
+        CAPTURE(true_probability);
+
+        constexpr uint32_t row_count = 100'000;
+        const auto query = std::format("WITH random_bools AS (SELECT rowid, value "
+                                       "FROM random_bool(true_probability={}) LIMIT {}) "
+                                       "SELECT COUNT(*) FILTER (WHERE value = previous) FROM "
+                                       "(SELECT value, LAG(value) OVER (ORDER BY rowid) AS previous FROM random_bools)",
+                                       true_probability,
+                                       row_count);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+
+        // Two independent values are equal with probability p^2 + (1 - p)^2
+        const double expected = (true_probability * true_probability +
+                                 (1 - true_probability) * (1 - true_probability)) * (row_count - 1);
+        const auto equal_count = res->GetValue<uint64_t>(0, 0);
+        CAPTURE(equal_count, expected);
+        CHECK(std::abs(static_cast<double>(equal_count) - expected) <= row_count * 0.01);
+    }
+}
@@ -0,0 +1,103 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/generators/catch_generators.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+#include "test_helpers/database_fixture.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+using Catch::Matchers::ContainsSubstring;
+using duckdb_faker::test_helpers::DatabaseFixture;
+
+TEST_CASE_METHOD(DatabaseFixture, "random_choice", "[choices]") {
+    SECTION("Should only produce the given values") {
+        const auto res = con.Query("SELECT DISTINCT value FROM random_choice(values=['red', 'green', 'blue']) "
+                                   "ORDER BY value");
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 3);
+        CHECK(res->GetValue(0, 0).GetValue<std::string>() == "blue");
+        CHECK(res->GetValue(0, 1).GetValue<std::string>() == "green");
+        CHECK(res->GetValue(0, 2).GetValue<std::string>() == "red");
+    }
+
+    SECTION("Should have the type of the values") {
+        const auto res = con.Query("SELECT typeof(value) FROM random_choice(values=[1.5, 2.5]) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<std::string>() == "DECIMAL(2,1)");
+    }
+
+    SECTION("Should pick values with equal probability by default") {
+        constexpr uint32_t row_count = 100'000;
+        const auto query = std::format("SELECT value, COUNT(*) FROM random_choice(values=[1, 2, 3, 4], rows={}) "
+                                       "GROUP BY value ORDER BY value",
+                                       row_count);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 4);
+        for (idx_t row = 0; row < 4; row++) {
+            const auto count = res->GetValue(1, row).GetValue<int64_t>();
+            CAPTURE(row, count);
+            CHECK(std::abs(count - static_cast<int64_t>(row_count / 4)) <= row_count * 0.01);
+        }
+    }
+
+    SECTION("Should pick values according to the weights") {
+        constexpr uint32_t row_count = 100'000;
+        const auto query = std::format("SELECT value, COUNT(*) FROM random_choice(values=['a', 'b', 'c', 'd'], "
+                                       "weights=[0.1, 0.2, 0, 0.7], rows={}) GROUP BY value ORDER BY value",
+                                       row_count);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        // 'c' has weight 0 and is never picked
+        REQUIRE(res->RowCount() == 3);
+        const double expected[] = {0.1, 0.2, 0.7};
+        for (idx_t row = 0; row < 3; row++) {
+            const auto count = res->GetValue(1, row).GetValue<int64_t>();
+            CAPTURE(row, count);
+            CHECK(std::abs(static_cast<double>(count) - expected[row] * row_count) <= row_count * 0.01);
+        }
+    }
+
+    SECTION("Should produce a constant if only one value can be picked") {
+        const auto query = GENERATE("SELECT COUNT(DISTINCT value), MIN(value) FROM random_choice(values=['x'])",
+                                    "SELECT COUNT(DISTINCT value), MIN(value) "
+                                    "FROM random_choice(values=['y', 'x'], weights=[0, 3])");
+        CAPTURE(query);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1);
+        CHECK(res->GetValue(1, 0).GetValue<std::string>() == "x");
+    }
+
+    SECTION("Should produce the same values for the same seed") {
+        const auto query = "SELECT list(value) FROM (SELECT value FROM random_choice(values=['a', 'b', 'c'], seed=3) "
+                           "LIMIT 5000)";
+        const auto res1 = con.Query(query);
+        const auto res2 = con.Query(query);
+        REQUIRE_FALSE(res1->HasError());
+        REQUIRE_FALSE(res2->HasError());
+        CHECK(res1->GetValue(0, 0) == res2->GetValue(0, 0));
+    }
+
+    SECTION("Should reject invalid arguments") {
+        auto [query, message] = GENERATE(
+            std::make_tuple("FROM random_choice()", "values must be specified"),
+            std::make_tuple("FROM random_choice(values=42)", "values must be a list"),
+            std::make_tuple("FROM random_choice(values=[])", "values must not be empty"),
+            std::make_tuple("FROM random_choice(values=[1, 2], weights=[1])",
+                            "weights must have the same number of elements as values"),
+            std::make_tuple("FROM random_choice(values=[1, 2], weights=[1, -1])",
+                            "weights must be finite, non-negative numbers"),
+            std::make_tuple("FROM random_choice(values=[1, 2], weights=[0, 0])",
+                            "weights must have a positive, finite sum"),
+            std::make_tuple("FROM random_choice(values=[1, 2], weights=[1, NULL])", "weights must not contain NULL"));
+        CAPTURE(query);
+
+        const auto res = con.Query(query);
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+}
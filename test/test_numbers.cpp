@@ -5,6 +5,7 @@
 #include "duckdb/main/database.hpp"
 #include "test_helpers/database_fixture.hpp"
 
+#include <cmath>
 #include <cstdint>
 
 using Catch::Matchers::ContainsSubstring;
@@ -66,6 +67,19 @@ TEST_CASE_METHOD(DatabaseFixture, "random_int bounds checks", "[numbers][integer
         }
     }
 
+    SECTION("Should produce a constant if minimum equals maximum") {
+        const int32_t value = GENERATE(-5, 0, 5, INT32_MAX);
+
+        const auto query = std::format(
+            "SELECT COUNT(*), MIN(value), MAX(value) FROM random_int(min={0}, max={0}, rows=10000)", value);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+        CHECK(res->GetValue(1, 0).GetValue<int32_t>() == value);
+        CHECK(res->GetValue(2, 0).GetValue<int32_t>() == value);
+    }
+
     SECTION("Should reject a minimum greater than maximum") {
         auto [min, max] = GENERATE(std::make_tuple<int32_t, int32_t>(1, 0), std::make_tuple<int32_t, int32_t>(-5, -6));
 
@@ -118,10 +132,395 @@ TEST_CASE_METHOD(DatabaseFixture, "random_int distributions", "[numbers][integer
         test_uniform_distribution("uniform");
     }
 
+    SECTION("Should produce normal distribution with given mean and stddev") {
+        const auto distribution = GENERATE("normal", "gaussian");
+        CAPTURE(distribution);
+
+        const auto query = std::format("SELECT AVG(value), STDDEV_POP(value), "
+                                       "COUNT(*) FILTER (WHERE value BETWEEN 900 AND 1100) / COUNT(*) "
+                                       "FROM random_int(distribution='{}', mean=1000, stddev=100, rows=100000)",
+                                       distribution);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+
+        const auto mean = res->GetValue(0, 0).GetValue<double>();
+        const auto stddev = res->GetValue(1, 0).GetValue<double>();
+        const auto within_one_stddev = res->GetValue(2, 0).GetValue<double>();
+        CAPTURE(mean, stddev, within_one_stddev);
+        CHECK(std::abs(mean - 1000) < 2);
+        CHECK(std::abs(stddev - 100) < 2);
+        // About 68% of the values lie within one standard deviation
+        CHECK(std::abs(within_one_stddev - 0.68) < 0.01);
+    }
+
+    SECTION("Should center normal values in minimum and maximum by default") {
+        const auto function = GENERATE("random_int", "random_utinyint");
+        CAPTURE(function);
+
+        const auto query = std::format("SELECT AVG(value), STDDEV_POP(value), "
+                                       "COUNT(*) FILTER (WHERE value IN (100, 200)) / COUNT(*) "
+                                       "FROM {}(distribution='normal', min=100, max=200, rows=100000)",
+                                       function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+
+        const auto mean = res->GetValue(0, 0).GetValue<double>();
+        const auto stddev = res->GetValue(1, 0).GetValue<double>();
+        const auto at_bounds = res->GetValue(2, 0).GetValue<double>();
+        CAPTURE(mean, stddev, at_bounds);
+        CHECK(std::abs(mean - 150) < 0.5);
+        // The bounds lie three standard deviations away from the mean
+        CHECK(std::abs(stddev - 100.0 / 6) < 0.5);
+        CHECK(at_bounds < 0.01);
+    }
+
+    SECTION("Should clamp normal values to minimum and maximum") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value) "
+                                   "FROM random_int(distribution='normal', mean=0, stddev=100, min=-10, max=10)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int32_t>() == -10);
+        CHECK(res->GetValue(1, 0).GetValue<int32_t>() == 10);
+    }
+
+    SECTION("Should produce zipf distribution with given skew") {
+        const double skew = GENERATE(0.8, 1.1, 2.0);
+        CAPTURE(skew);
+
+        constexpr uint32_t row_count = 100'000;
+        const auto query = std::format("SELECT value, COUNT(*) FROM random_int(distribution='zipf', skew={}, "
+                                       "min=1, max=10, rows={}) GROUP BY value ORDER BY value",
+                                       skew,
+                                       row_count);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 10);
+
+        // The probability of value k is proportional to 1 / k^skew
+        double normalization = 0;
+        for (int k = 1; k <= 10; k++) {
+            normalization += std::pow(k, -skew);
+        }
+        for (idx_t row = 0; row < 10; row++) {
+            const auto value = res->GetValue(0, row).GetValue<int32_t>();
+            const auto count = res->GetValue(1, row).GetValue<int64_t>();
+            const double expected = std::pow(value, -skew) / normalization * row_count;
+            CAPTURE(value, count, expected);
+            CHECK(std::abs(static_cast<double>(count) - expected) <= row_count * 0.01);
+        }
+    }
+
+    SECTION("Should produce zipf distribution over large domains") {
+        const auto res = con.Query("SELECT MIN(value), COUNT(*) FILTER (WHERE value = -2147483648) > 1000 "
+                                   "FROM random_int(distribution='zipf', skew=1.1, rows=100000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int32_t>() == INT32_MIN);
+        CHECK(res->GetValue(1, 0).GetValue<bool>());
+    }
+
+    SECTION("Should reject invalid distribution parameters") {
+        auto [query, message] = GENERATE(
+            std::make_tuple("FROM random_int(mean=5)", "can only be specified for the normal distribution"),
+            std::make_tuple("FROM random_int(distribution='uniform', stddev=5)",
+                            "can only be specified for the normal distribution"),
+            std::make_tuple("FROM random_int(distribution='normal', stddev=-1)", "stddev must be"),
+            std::make_tuple("FROM random_int(distribution='normal', mean='inf')", "mean must be a finite number"),
+            std::make_tuple("FROM random_int(skew=1.5)", "can only be specified for the zipf distribution"),
+            std::make_tuple("FROM random_int(distribution='zipf', skew=0)", "skew must be"),
+            std::make_tuple("FROM random_hugeint(distribution='zipf', min=0, max=18446744073709551616)",
+                            "The zipf distribution supports at most 2^64 values"));
+        CAPTURE(query);
+
+        auto res = con.Query(query);
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+
     SECTION("Should reject unknown distribution arguments") {
         auto res = con.Query("FROM random_int(distribution='unknown')");
         REQUIRE(res->HasError());
         CHECK_THAT(res->GetError(),
                    ContainsSubstring("Invalid Input Error: Unknown probability distribution \"unknown\""));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random integer types", "[numbers][integers]") {
+    SECTION("Should produce the native type of each function") {
+        auto [function, type] = GENERATE(std::make_tuple("random_tinyint", "TINYINT"),
+                                         std::make_tuple("random_smallint", "SMALLINT"),
+                                         std::make_tuple("random_int", "INTEGER"),
+                                         std::make_tuple("random_bigint", "BIGINT"),
+                                         std::make_tuple("random_hugeint", "HUGEINT"),
+                                         std::make_tuple("random_utinyint", "UTINYINT"),
+                                         std::make_tuple("random_usmallint", "USMALLINT"),
+                                         std::make_tuple("random_uinteger", "UINTEGER"),
+                                         std::make_tuple("random_ubigint", "UBIGINT"),
+                                         std::make_tuple("random_uhugeint", "UHUGEINT"));
+        CAPTURE(function);
+
+        const auto query = std::format("SELECT DISTINCT typeof(value) FROM {}(rows=1000)", function);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).ToString() == type);
+    }
+
+    SECTION("Should respect bounds beyond the INTEGER range") {
+        auto [function, type, min, max] = GENERATE(
+            std::make_tuple("random_bigint", "BIGINT", "-9223372036854775808", "-9223372036854775000"),
+            std::make_tuple("random_bigint", "BIGINT", "-5000000000", "5000000000"),
+            std::make_tuple("random_ubigint", "UBIGINT", "18446744073709550000", "18446744073709551615"),
+            std::make_tuple("random_hugeint", "HUGEINT", "-170141183460469231731687303715884105728", "0"),
+            std::make_tuple("random_hugeint", "HUGEINT", "-10", "100000000000000000000000"),
+            std::make_tuple("random_uhugeint", "UHUGEINT", "18446744073709551616", "18446744073709551620"));
+        CAPTURE(function, min, max);
+
+        const auto query = std::format("SELECT COUNT(*) FROM {0}(min={2}, max={3}, rows=10000) "
+                                       "WHERE value < {2}::{1} OR value > {3}::{1}",
+                                       function,
+                                       type,
+                                       min,
+                                       max);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should cover the full range of the type by default") {
+        auto [function, type, lower, upper] = GENERATE(
+            std::make_tuple("random_tinyint", "TINYINT", "-64", "64"),
+            std::make_tuple("random_bigint", "BIGINT", "-4611686018427387904", "4611686018427387904"),
+            std::make_tuple("random_hugeint",
+                            "HUGEINT",
+                            "-85070591730234615865843651857942052864",
+                            "85070591730234615865843651857942052864"),
+            std::make_tuple("random_ubigint", "UBIGINT", "4611686018427387904", "13835058055282163712"));
+        CAPTURE(function);
+
+        // Values must fall into both the lowest and the highest quarter of the type
+        const auto query = std::format(
+            "SELECT MIN(value) < {2}::{1}, MAX(value) > {3}::{1} FROM {0}(rows=10000)", function, type, lower, upper);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<bool>());
+        CHECK(res->GetValue(1, 0).GetValue<bool>());
+    }
+
+    SECTION("Should reject bounds outside of the type") {
+        auto [function, bound] = GENERATE(std::make_tuple("random_tinyint", "min=-129"),
+                                          std::make_tuple("random_utinyint", "max=256"),
+                                          std::make_tuple("random_uinteger", "min=-1"),
+                                          std::make_tuple("random_bigint", "max=9223372036854775808"));
+        CAPTURE(function, bound);
+
+        const auto query = std::format("SELECT value FROM {}({})", function, bound);
+        const auto res = con.Query(query);
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("out of range"));
+    }
+
+    SECTION("Should support distributions for all types") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value) "
+                                   "FROM random_hugeint(min=100000000000000000000, max=100000000000000000010, "
+                                   "distribution='normal', mean=1e20, stddev=1e30, rows=1000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "100000000000000000000");
+        CHECK(res->GetValue(1, 0).ToString() == "100000000000000000010");
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_double and random_float", "[numbers][floats]") {
+    SECTION("Should produce the native type of each function") {
+        auto [function, type] =
+            GENERATE(std::make_tuple("random_float", "FLOAT"), std::make_tuple("random_double", "DOUBLE"));
+        CAPTURE(function);
+
+        const auto res = con.Query(std::format("SELECT DISTINCT typeof(value) FROM {}(rows=1000)", function));
+
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).ToString() == type);
+    }
+
+    SECTION("Should produce uniform values in [0, 1] by default") {
+        const auto function = GENERATE("random_float", "random_double");
+        CAPTURE(function);
+
+        const auto query = std::format("SELECT MIN(value), MAX(value), AVG(value) FROM {}(rows=100000)", function);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<double>() >= 0.0);
+        CHECK(res->GetValue(1, 0).GetValue<double>() <= 1.0);
+        CHECK(std::abs(res->GetValue(2, 0).GetValue<double>() - 0.5) < 0.01);
+    }
+
+    SECTION("Should respect minimum and maximum") {
+        auto [min, max] = GENERATE(std::make_tuple(-1000.5, 42.25),
+                                   std::make_tuple(0.001, 0.002),
+                                   std::make_tuple(-1.7976931348623157e308, 1.7976931348623157e308));
+        CAPTURE(min, max);
+
+        const auto query = std::format("SELECT COUNT(*) FROM random_double(min={0}, max={1}, rows=10000) "
+                                       "WHERE value < {0} OR value > {1} OR isnan(value)",
+                                       min,
+                                       max);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should produce a constant if minimum equals maximum") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value) FROM random_float(min=2.5, max=2.5, rows=10000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<float>() == 2.5F);
+        CHECK(res->GetValue(1, 0).GetValue<float>() == 2.5F);
+    }
+
+    SECTION("Should follow the normal distribution") {
+        constexpr uint32_t limit = 100000;
+        const auto query = std::format("SELECT AVG(value), STDDEV_POP(value) "
+                                       "FROM random_double(distribution='normal', mean=100, stddev=15, rows={})",
+                                       limit);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(std::abs(res->GetValue(0, 0).GetValue<double>() - 100.0) < 0.5);
+        CHECK(std::abs(res->GetValue(1, 0).GetValue<double>() - 15.0) < 0.5);
+    }
+
+    SECTION("Should center normal values in minimum and maximum by default") {
+        const auto res = con.Query("SELECT AVG(value), STDDEV_POP(value) "
+                                   "FROM random_double(distribution='normal', min=-50, max=10, rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(std::abs(res->GetValue(0, 0).GetValue<double>() - -20.0) < 0.5);
+        CHECK(std::abs(res->GetValue(1, 0).GetValue<double>() - 10.0) < 0.5);
+    }
+
+    SECTION("Should clamp normal values to minimum and maximum") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value) FROM random_float(distribution='normal', "
+                                   "mean=0, stddev=1e30, min=-1, max=1, rows=1000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<float>() == -1.0F);
+        CHECK(res->GetValue(1, 0).GetValue<float>() == 1.0F);
+    }
+
+    SECTION("Should reject invalid parameters") {
+        auto [params, message] = GENERATE(
+            std::make_tuple("min=1, max=0", "Minimum value must be less than or equal to maximum value"),
+            std::make_tuple("min='inf'", "Minimum and maximum value must be finite numbers"),
+            std::make_tuple("max='nan'", "Minimum and maximum value must be finite numbers"),
+            std::make_tuple("distribution='zipf'", "The zipf distribution is only supported for integers"),
+            std::make_tuple("mean=1", "mean and stddev can only be specified for the normal distribution"));
+        CAPTURE(params);
+
+        const auto res = con.Query(std::format("SELECT value FROM random_double({})", params));
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_decimal", "[numbers][decimals]") {
+    SECTION("Should use the physical type matching the width") {
+        auto [width, scale, type] = GENERATE(std::make_tuple(4, 2, "DECIMAL(4,2)"),
+                                             std::make_tuple(9, 0, "DECIMAL(9,0)"),
+                                             std::make_tuple(18, 2, "DECIMAL(18,2)"),
+                                             std::make_tuple(38, 10, "DECIMAL(38,10)"));
+        CAPTURE(type);
+
+        const auto query = std::format("SELECT typeof(ANY_VALUE(value)), MIN(value) < 0, MAX(value) > 0 "
+                                       "FROM random_decimal(width={}, scale={}, rows=1000)",
+                                       width,
+                                       scale);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == type);
+        CHECK(res->GetValue(1, 0).GetValue<bool>());
+        CHECK(res->GetValue(2, 0).GetValue<bool>());
+    }
+
+    SECTION("Should default to DECIMAL(18,3)") {
+        const auto res = con.Query("SELECT DISTINCT typeof(value) FROM random_decimal(rows=100)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "DECIMAL(18,3)");
+    }
+
+    SECTION("Should respect minimum and maximum exactly") {
+        const auto res = con.Query("SELECT MIN(value)::VARCHAR, MAX(value)::VARCHAR, COUNT(DISTINCT value) "
+                                   "FROM random_decimal(width=18, scale=2, min=0.01, max='0.05', rows=10000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "0.01");
+        CHECK(res->GetValue(1, 0).ToString() == "0.05");
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 5);
+    }
+
+    SECTION("Should distribute values uniformly over the scaled integers") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (value < 0.5), COUNT(*) "
+                                   "FROM random_decimal(width=4, scale=2, min=0, max=0.99, rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        const double lower_half = res->GetValue(0, 0).GetValue<double>() / res->GetValue(1, 0).GetValue<double>();
+        CHECK(std::abs(lower_half - 0.5) < 0.01);
+    }
+
+    SECTION("Should reject invalid parameters") {
+        auto [params, message] = GENERATE(
+            std::make_tuple("width=0", "width must be between 1 and 38"),
+            std::make_tuple("width=39", "width must be between 1 and 38"),
+            std::make_tuple("width=4, scale=5", "scale must be between 0 and width"),
+            std::make_tuple("min=2, max=1", "Minimum value must be less than or equal to maximum value"),
+            std::make_tuple("width=4, scale=2, max=100", "Could not cast value"));
+        CAPTURE(params);
+
+        const auto res = con.Query(std::format("SELECT value FROM random_decimal({})", params));
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random number statistics", "[numbers][statistics]") {
+    SECTION("Should propagate the bounds of integers") {
+        const auto res = con.Query("SELECT stats(value) FROM random_int(min=0, max=100) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        const auto stats = res->GetValue(0, 0).ToString();
+        CHECK_THAT(stats, ContainsSubstring("Min: 0, Max: 100"));
+        CHECK_THAT(stats, ContainsSubstring("Has Null: false"));
+    }
+
+    SECTION("Should propagate the bounds of floating-point numbers") {
+        const auto res = con.Query("SELECT stats(value) FROM random_double(min=-1.5, max=2.5) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        CHECK_THAT(res->GetValue(0, 0).ToString(), ContainsSubstring("Min: -1.5, Max: 2.5"));
+    }
+
+    SECTION("Should report that intervals have no NULLs") {
+        const auto res = con.Query("SELECT stats(value) FROM random_interval() LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        CHECK_THAT(res->GetValue(0, 0).ToString(), ContainsSubstring("Has Null: false"));
+    }
+
+    SECTION("Should prune filters outside of the bounds") {
+        const auto res = con.Query("SELECT COUNT(*) FROM random_int(min=0, max=100, rows=10000) WHERE value > 100");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should report NULLs") {
+        const auto res = con.Query("SELECT stats(value) FROM random_int(null_probability=0.5) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        CHECK_THAT(res->GetValue(0, 0).ToString(), ContainsSubstring("Has Null: true"));
+    }
+}
@@ -3,6 +3,7 @@
 #include "catch2/matchers/catch_matchers_string.hpp"
 #include "test_helpers/database_fixture.hpp"
 
+#include <cmath>
 #include <cstdint>
 #include <sstream>
 #include <string>
@@ -38,6 +39,52 @@ TEST_CASE_METHOD(DatabaseFixture, "random_data source_schema", "[mixed_types]")
         CHECK(column_types[2] == duckdb::LogicalType::VARCHAR);
     }
 
+    SECTION("Should generate all integer types natively") {
+        con.Query("CREATE TABLE int_tbl (a TINYINT, b SMALLINT, c INTEGER, d BIGINT, e HUGEINT, "
+                  "f UTINYINT, g USMALLINT, h UINTEGER, i UBIGINT, j UHUGEINT)");
+
+        const auto insert_res = con.Query("INSERT INTO int_tbl SELECT * FROM random_data(schema_source='int_tbl') "
+                                          "LIMIT 1000");
+        REQUIRE_FALSE(insert_res->HasError());
+
+        // Values beyond the INTEGER range are only possible if the full type is generated
+        const auto res = con.Query("SELECT COUNT(*) FILTER (d > 2147483647), COUNT(*) FILTER (e < -2147483648), "
+                                   "COUNT(*) FILTER (i > 4294967295) FROM int_tbl");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() > 0);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() > 0);
+    }
+
+    SECTION("Should generate floating-point columns") {
+        con.Query("CREATE TABLE float_tbl (a FLOAT, b DOUBLE)");
+
+        const auto res = con.Query("SELECT typeof(a), typeof(b), MIN(a), MAX(a), MIN(b), MAX(b) "
+                                   "FROM random_data(schema_source='float_tbl', rows=1000) GROUP BY ALL");
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).ToString() == "FLOAT");
+        CHECK(res->GetValue(1, 0).ToString() == "DOUBLE");
+        CHECK(res->GetValue(2, 0).GetValue<double>() >= 0.0);
+        CHECK(res->GetValue(3, 0).GetValue<double>() <= 1.0);
+        CHECK(res->GetValue(4, 0).GetValue<double>() >= 0.0);
+        CHECK(res->GetValue(5, 0).GetValue<double>() <= 1.0);
+    }
+
+    SECTION("Should generate decimal columns of every width") {
+        con.Query("CREATE TABLE decimal_tbl (a DECIMAL(4,1), b DECIMAL(9,3), c DECIMAL(18,2), d DECIMAL(38,0))");
+
+        const auto insert_res = con.Query("INSERT INTO decimal_tbl SELECT * FROM random_data("
+                                          "schema_source='decimal_tbl', rows=1000)");
+        REQUIRE_FALSE(insert_res->HasError());
+
+        const auto res = con.Query("SELECT COUNT(*) FILTER (abs(c) > 1e14), COUNT(*) FILTER (abs(d) > 1e35) "
+                                   "FROM decimal_tbl");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() > 0);
+    }
+
     SECTION("Recognized fully-qualified table name") {
         con.Query("ATTACH ':memory:' AS test_db");
         con.Query("CREATE SCHEMA test_db.test_schema");
@@ -117,3 +164,403 @@ TEST_CASE_METHOD(DatabaseFixture, "random_data source_schema slow", "[mixed_type
         CHECK(column_types[6002] == duckdb::LogicalType::VARCHAR);
     }
 }
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data rows", "[mixed_types]") {
+    SECTION("Should produce the number of rows specified") {
+        con.Query("CREATE TABLE source_tbl (a INT, b BOOLEAN, c VARCHAR)");
+
+        const auto res = con.Query("SELECT COUNT(*) FROM random_data(schema_source='source_tbl', rows=300000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<uint64_t>() == 300000);
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data native scan", "[mixed_types]") {
+    con.Query("CREATE TABLE source_tbl (a INT, b INT, c BOOLEAN, d VARCHAR)");
+
+    SECTION("Should expose the rowid column") {
+        const auto res = con.Query("SELECT rowid, a FROM random_data(schema_source='source_tbl') LIMIT 10");
+        REQUIRE_FALSE(res->HasError());
+        for (idx_t row = 0; row < 10; row++) {
+            REQUIRE(res->GetValue(0, row).GetValue<int64_t>() == static_cast<int64_t>(row));
+        }
+    }
+
+    SECTION("Should produce the same values regardless of the projected columns") {
+        const auto res_all = con.Query("SELECT a, d FROM random_data(schema_source='source_tbl', seed=42) LIMIT 100");
+        const auto res_single = con.Query("SELECT d FROM random_data(schema_source='source_tbl', seed=42) LIMIT 100");
+        REQUIRE_FALSE(res_all->HasError());
+        REQUIRE_FALSE(res_single->HasError());
+        for (idx_t row = 0; row < 100; row++) {
+            REQUIRE(res_all->GetValue(1, row) == res_single->GetValue(0, row));
+        }
+    }
+
+    SECTION("Should generate columns of the same type independently") {
+        const auto res = con.Query("SELECT COUNT(*) FROM "
+                                   "(FROM random_data(schema_source='source_tbl') LIMIT 1000) "
+                                   "WHERE a <> b");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 0);
+    }
+
+    SECTION("Should generate values for narrow integer columns that fit into the column") {
+        con.Query("CREATE TABLE narrow_tbl (a TINYINT, b SMALLINT)");
+        const auto res = con.Query("INSERT INTO narrow_tbl SELECT * FROM random_data(schema_source='narrow_tbl')");
+        REQUIRE_FALSE(res->HasError());
+    }
+
+    SECTION("Should produce NULLs in all columns with a single probability") {
+        const auto res = con.Query("SELECT COUNT(*) - COUNT(a), COUNT(*) - COUNT(d) "
+                                   "FROM random_data(schema_source='source_tbl', null_probability=0.5, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 4000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() > 4000);
+    }
+
+    SECTION("Should produce NULLs per column") {
+        const auto res = con.Query("SELECT COUNT(*) - COUNT(a), COUNT(*) - COUNT(b), COUNT(*) - COUNT(d) "
+                                   "FROM random_data(schema_source='source_tbl', "
+                                   "null_probability={'a': 1.0, 'D': 0.5}, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+        const auto d_nulls = res->GetValue(2, 0).GetValue<int64_t>();
+        CHECK((d_nulls > 4000 && d_nulls < 6000));
+    }
+
+    SECTION("Should reject NULL probabilities for unknown columns") {
+        const auto res = con.Query("FROM random_data(schema_source='source_tbl', null_probability={'x': 0.5})");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("null_probability refers to unknown column \"x\""));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data nested types", "[mixed_types][nested]") {
+    con.Query("CREATE TABLE events (tags VARCHAR[], payload STRUCT(id INT, name VARCHAR, flags BOOLEAN[]), "
+              "point DOUBLE[3], attributes MAP(VARCHAR, INT), matrix INT[][])");
+
+    SECTION("Should generate nested columns that can be inserted") {
+        const auto res = con.Query("INSERT INTO events SELECT * FROM random_data(schema_source='events', rows=5000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 5000);
+    }
+
+    SECTION("Should respect the default list lengths") {
+        const auto res = con.Query("SELECT MIN(len(tags)), MAX(len(tags)), MIN(len(payload.flags)), "
+                                   "MAX(len(payload.flags)), COUNT(*) FILTER (len(point) <> 3) "
+                                   "FROM random_data(schema_source='events', rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 5);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == 5);
+        CHECK(res->GetValue(4, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should respect min_list_length and max_list_length") {
+        const auto res = con.Query("SELECT MIN(len(tags)), MAX(len(tags)), MIN(len(matrix[1])), MAX(len(matrix[1])) "
+                                   "FROM random_data(schema_source='events', min_list_length=2, max_list_length=3, "
+                                   "rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 2);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 3);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 2);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == 3);
+    }
+
+    SECTION("Should generate distinct elements within and across rows") {
+        const auto res = con.Query("SELECT COUNT(DISTINCT element), COUNT(element) FROM "
+                                   "(SELECT unnest(flatten(matrix)) AS element FROM random_data("
+                                   "schema_source='events', min_list_length=5, max_list_length=5, rows=1000))");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 24900);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 25000);
+    }
+
+    SECTION("Should generate maps without duplicate keys") {
+        con.Query("CREATE TABLE flags (m MAP(BOOLEAN, INT))");
+
+        const auto res = con.Query("SELECT MAX(cardinality(m)), COUNT(*) FILTER (len(map_keys(m)) <> "
+                                   "len(list_distinct(map_keys(m)))) FROM random_data(schema_source='flags', "
+                                   "min_list_length=5, rows=1000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 2);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should make the fields of NULL structs NULL") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (payload IS NULL), "
+                                   "COUNT(*) FILTER (payload IS NULL AND payload.id IS NOT NULL) "
+                                   "FROM random_data(schema_source='events', null_probability=0.5, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 4000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should keep the lists of valid rows next to NULL lists") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (tags IS NULL), MIN(len(tags)), MAX(len(tags)), "
+                                   "COUNT(*) FILTER (len(list_filter(tags, x -> x IS NULL)) > 0) FROM random_data("
+                                   "schema_source='events', null_probability=0.5, min_list_length=2, "
+                                   "max_list_length=3, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 4000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 2);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 3);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should reject invalid list lengths") {
+        auto [params, message] = GENERATE(
+            std::make_tuple("min_list_length=3, max_list_length=2",
+                            "min_list_length must be less than or equal to max_list_length"),
+            std::make_tuple("max_list_length=4294967296", "max_list_length must be less than or equal to 4294967295"));
+        CAPTURE(params);
+
+        const auto res = con.Query(std::format("FROM random_data(schema_source='events', {})", params));
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), Catch::Matchers::ContainsSubstring(message));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data constraints", "[mixed_types][constraints]") {
+    SECTION("Should generate primary keys and unique columns that can be inserted") {
+        con.Query("CREATE TABLE users (id INT PRIMARY KEY, name VARCHAR UNIQUE, born DATE UNIQUE, "
+                  "email VARCHAR NOT NULL)");
+
+        const auto res = con.Query("INSERT INTO users SELECT * FROM random_data(schema_source='users', "
+                                   "null_probability=0.5, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+
+        const auto check_res = con.Query("SELECT COUNT(DISTINCT id), COUNT(email) FROM users");
+        CHECK(check_res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+        CHECK(check_res->GetValue(1, 0).GetValue<int64_t>() == 10000);
+    }
+
+    SECTION("Should generate unique values of every supported type") {
+        con.Query("CREATE TABLE keys (a TINYINT PRIMARY KEY, b UBIGINT UNIQUE, c HUGEINT UNIQUE, "
+                  "d DECIMAL(2, 1) UNIQUE, e TIMESTAMP UNIQUE, f UUID UNIQUE, g VARCHAR UNIQUE)");
+
+        const auto res = con.Query("INSERT INTO keys SELECT * FROM random_data(schema_source='keys', rows=199)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 199);
+    }
+
+    SECTION("Should generate unique values for compound keys") {
+        con.Query("CREATE TABLE pairs (a BOOLEAN, b INT, PRIMARY KEY (b, a))");
+
+        const auto res = con.Query("INSERT INTO pairs SELECT * FROM random_data(schema_source='pairs', rows=1000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1000);
+    }
+
+    SECTION("Should make the first suitable column of a compound key unique") {
+        con.Query("CREATE TABLE flagged (flag BOOLEAN, small TINYINT, id INT, PRIMARY KEY (flag, small, id))");
+
+        const auto res = con.Query("INSERT INTO flagged SELECT * FROM random_data(schema_source='flagged', rows=1000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1000);
+        const auto distinct_ids = con.Query("SELECT COUNT(DISTINCT id) FROM flagged");
+        REQUIRE_FALSE(distinct_ids->HasError());
+        CHECK(distinct_ids->GetValue(0, 0).GetValue<int64_t>() == 1000);
+    }
+
+    SECTION("Should produce the same unique values regardless of LIMIT") {
+        con.Query("CREATE TABLE ids (id BIGINT PRIMARY KEY)");
+
+        const auto res = con.Query("SELECT COUNT(*) FROM "
+                                   "(FROM random_data(schema_source='ids', rows=1000) LIMIT 10) AS head "
+                                   "JOIN random_data(schema_source='ids', rows=1000) AS full_data USING (id)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10);
+    }
+
+    SECTION("Should reject more rows than there are unique values") {
+        con.Query("CREATE TABLE tiny (id TINYINT PRIMARY KEY)");
+
+        const auto res = con.Query("FROM random_data(schema_source='tiny', rows=257)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("Cannot generate 257 unique values of type TINYINT"));
+    }
+
+    SECTION("Should reject unique columns of unsupported types") {
+        con.Query("CREATE TABLE flags (flag BOOLEAN UNIQUE)");
+
+        const auto res = con.Query("FROM random_data(schema_source='flags', rows=2)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("Unique values are not supported for type: BOOLEAN"));
+    }
+
+    SECTION("Should generate foreign keys that reference existing rows") {
+        con.Query("CREATE TABLE customers (id INT PRIMARY KEY, name VARCHAR UNIQUE NOT NULL)");
+        con.Query("CREATE TABLE orders (id BIGINT PRIMARY KEY, customer_id INT REFERENCES customers (id), "
+                  "customer_name VARCHAR REFERENCES customers (name))");
+        con.Query("INSERT INTO customers SELECT * FROM random_data(schema_source='customers', seed=42, rows=1000)");
+
+        const auto res = con.Query("INSERT INTO orders SELECT * FROM random_data(schema_source='orders', seed=42, "
+                                   "rows=10000, parent_rows=1000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+
+        const auto check_res = con.Query("SELECT COUNT(DISTINCT customer_id), COUNT(DISTINCT customer_name) "
+                                         "FROM orders");
+        CHECK(check_res->GetValue(0, 0).GetValue<int64_t>() > 990);
+        CHECK(check_res->GetValue(1, 0).GetValue<int64_t>() > 990);
+    }
+
+    SECTION("Should sample the same referenced row for all columns of a compound foreign key") {
+        con.Query("CREATE TABLE products (sku INT, version INT, PRIMARY KEY (sku, version))");
+        con.Query("CREATE TABLE order_items (sku INT, version INT, FOREIGN KEY (sku, version) "
+                  "REFERENCES products (sku, version))");
+        con.Query("INSERT INTO products SELECT * FROM random_data(schema_source='products', seed=7, rows=100)");
+
+        const auto res = con.Query("INSERT INTO order_items SELECT * FROM random_data(schema_source='order_items', "
+                                   "seed=7, rows=1000, parent_rows={'PRODUCTS': 100})");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1000);
+    }
+
+    SECTION("Should reference rows of the same table") {
+        con.Query("CREATE TABLE employees (id INT PRIMARY KEY, manager_id INT REFERENCES employees (id))");
+
+        const auto res = con.Query("WITH e AS (FROM random_data(schema_source='employees', rows=1000, seed=3)) "
+                                   "SELECT COUNT(*) FROM e WHERE manager_id NOT IN (SELECT id FROM e)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should require a seed for foreign keys") {
+        con.Query("CREATE TABLE parents (id INT PRIMARY KEY)");
+        con.Query("CREATE TABLE children (parent_id INT REFERENCES parents (id))");
+
+        const auto res = con.Query("FROM random_data(schema_source='children')");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("Tables with FOREIGN KEY constraints require a seed"));
+    }
+
+    SECTION("Should reject foreign keys that reference nullable columns") {
+        con.Query("CREATE TABLE parents (id INT PRIMARY KEY, code INT UNIQUE)");
+        con.Query("CREATE TABLE children (parent_code INT REFERENCES parents (code))");
+
+        const auto res = con.Query("FROM random_data(schema_source='children', seed=1)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("must reference a NOT NULL or PRIMARY KEY column"));
+    }
+
+    SECTION("Should reject more parent rows than the referenced table has") {
+        con.Query("CREATE TABLE parents (id INT PRIMARY KEY)");
+        con.Query("CREATE TABLE children (parent_id INT REFERENCES parents (id))");
+        con.Query("INSERT INTO parents SELECT * FROM random_data(schema_source='parents', seed=1, rows=100)");
+
+        const auto res = con.Query("FROM random_data(schema_source='children', seed=1, parent_rows=1000)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   Catch::Matchers::ContainsSubstring("Foreign keys reference 1000 rows of table \"parents\""));
+    }
+
+    SECTION("Should reject invalid parent_rows") {
+        con.Query("CREATE TABLE parents (id INT PRIMARY KEY)");
+        con.Query("CREATE TABLE children (parent_id INT REFERENCES parents (id))");
+
+        const auto res = con.Query("FROM random_data(schema_source='children', seed=1, parent_rows=0)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), Catch::Matchers::ContainsSubstring("parent_rows must be between 1 and 2^63"));
+    }
+
+    SECTION("Should reject CHECK constraints") {
+        con.Query("CREATE TABLE checked (a INT CHECK (a > 0))");
+
+        const auto res = con.Query("FROM random_data(schema_source='checked')");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), Catch::Matchers::ContainsSubstring("CHECK constraints are not supported"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data profile", "[mixed_types][profile]") {
+    con.Query("CREATE TABLE source (status VARCHAR, amount INT, score DOUBLE, comment VARCHAR)");
+    con.Query("INSERT INTO source SELECT CASE WHEN i % 10 < 7 THEN 'open' WHEN i % 10 < 9 THEN 'closed' "
+              "ELSE 'pending' END, (i * 37) % 1000 + 1000, CASE WHEN i % 4 = 0 THEN NULL ELSE i / 100 END, "
+              "repeat('x', 5 + i % 20) || i::VARCHAR FROM range(10000) t(i)");
+
+    SECTION("Should reproduce the values and frequencies of low-cardinality columns") {
+        const auto res = con.Query("SELECT status, COUNT(*) / 10000 FROM random_data(schema_source='source', "
+                                   "profile=true, rows=10000) GROUP BY status ORDER BY status");
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 3);
+        CHECK(res->GetValue(0, 0).ToString() == "closed");
+        CHECK(std::abs(res->GetValue(1, 0).GetValue<double>() - 0.2) < 0.03);
+        CHECK(res->GetValue(0, 1).ToString() == "open");
+        CHECK(std::abs(res->GetValue(1, 1).GetValue<double>() - 0.7) < 0.03);
+        CHECK(res->GetValue(0, 2).ToString() == "pending");
+        CHECK(std::abs(res->GetValue(1, 2).GetValue<double>() - 0.1) < 0.03);
+    }
+
+    SECTION("Should keep numbers within the range of the source and follow its distribution") {
+        const auto res = con.Query("SELECT MIN(amount), MAX(amount), MEDIAN(amount), MIN(score), MAX(score) "
+                                   "FROM random_data(schema_source='source', profile=true, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int32_t>() >= 1000);
+        CHECK(res->GetValue(1, 0).GetValue<int32_t>() <= 1999);
+        CHECK(std::abs(res->GetValue(2, 0).GetValue<double>() - 1500) < 50);
+        CHECK(res->GetValue(3, 0).GetValue<double>() >= 0);
+        CHECK(res->GetValue(4, 0).GetValue<double>() <= 99.99);
+    }
+
+    SECTION("Should reproduce the fraction of NULLs") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (score IS NULL) / 10000 "
+                                   "FROM random_data(schema_source='source', profile=true, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(std::abs(res->GetValue(0, 0).GetValue<double>() - 0.25) < 0.03);
+    }
+
+    SECTION("Should prefer an explicit null_probability over the profile") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (score IS NULL) FROM random_data("
+                                   "schema_source='source', profile=true, null_probability=0, rows=1000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should keep string lengths within the range of the source") {
+        const auto res = con.Query("SELECT MIN(length(comment)), MAX(length(comment)) "
+                                   "FROM random_data(schema_source='source', profile=true, rows=10000)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() >= 6);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() <= 28);
+    }
+
+    SECTION("Should be reproducible with a seed") {
+        const auto res = con.Query("SELECT COUNT(*) FROM "
+                                   "(FROM random_data(schema_source='source', profile=true, seed=5, rows=1000) "
+                                   "EXCEPT ALL FROM random_data(schema_source='source', profile=true, seed=5, "
+                                   "rows=1000))");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should profile temporary tables and uncommitted rows") {
+        con.Query("CREATE TEMP TABLE temp_source (level VARCHAR)");
+        con.Query("BEGIN");
+        con.Query("INSERT INTO temp_source SELECT CASE WHEN i % 2 = 0 THEN 'low' ELSE 'high' END FROM range(100) t(i)");
+
+        const auto res = con.Query("SELECT COUNT(*) FILTER (level NOT IN ('low', 'high')) "
+                                   "FROM random_data(schema_source='temp_source', profile=true, rows=1000)");
+        con.Query("ROLLBACK");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should profile an empty table") {
+        con.Query("CREATE TABLE empty_source (a INT, b VARCHAR)");
+
+        const auto res = con.Query("SELECT COUNT(*) FROM random_data(schema_source='empty_source', profile=true, "
+                                   "rows=100)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 100);
+    }
+}
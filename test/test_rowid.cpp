@@ -85,4 +85,129 @@ TEST_CASE_METHOD(DatabaseFixture, "Generator functions expose 'rowid' column", "
             REQUIRE(res->GetValue(0, result_id).GetValue<int64_t>() == result_id + 100);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions only generate rows matching rowid filters", "[rowid]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    // Generating all of these rows would take forever
+    const std::string huge_table = std::format("{}(rows=9223372036854775807, seed=42)", table_function);
+
+    SECTION("Point lookups") {
+        const auto query = std::format("SELECT rowid FROM {} WHERE rowid = 5000000000000", huge_table);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 5000000000000);
+    }
+
+    SECTION("IN lists") {
+        const auto query = std::format(
+            "SELECT rowid FROM {} WHERE rowid IN (7, 5000000000000, 3, 7, -1) ORDER BY rowid", huge_table);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 3);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 3);
+        CHECK(res->GetValue(0, 1).GetValue<int64_t>() == 7);
+        CHECK(res->GetValue(0, 2).GetValue<int64_t>() == 5000000000000);
+    }
+
+    SECTION("Ranges") {
+        const auto query = std::format("SELECT COUNT(*), MIN(rowid), MAX(rowid) FROM {} "
+                                       "WHERE rowid BETWEEN 1000000000000 AND 1000000009999 OR rowid < 10",
+                                       huge_table);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10010);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 1000000009999);
+    }
+
+    SECTION("Rowids beyond the number of rows") {
+        const auto query = std::format("SELECT rowid FROM {}(rows=100) WHERE rowid >= 99", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 99);
+    }
+
+    SECTION("Filtered rows have the same values as in an unfiltered scan") {
+        const auto query_full = std::format("SELECT value FROM {}(seed=7) LIMIT 3000", table_function);
+        const auto query_filtered = std::format(
+            "SELECT value FROM {}(seed=7) WHERE rowid IN (3, 17, 2500) ORDER BY rowid", table_function);
+        const auto res_full = con.Query(query_full);
+        const auto res_filtered = con.Query(query_filtered);
+        REQUIRE_FALSE(res_full->HasError());
+        REQUIRE_FALSE(res_filtered->HasError());
+        REQUIRE(res_filtered->RowCount() == 3);
+        CHECK(res_filtered->GetValue(0, 0) == res_full->GetValue(0, 3));
+        CHECK(res_filtered->GetValue(0, 1) == res_full->GetValue(0, 17));
+        CHECK(res_filtered->GetValue(0, 2) == res_full->GetValue(0, 2500));
+    }
+
+    SECTION("Filters on other columns are still applied") {
+        const auto query = std::format("SELECT COUNT(*) FROM {}(rows=100) WHERE rowid < 50 AND rowid::VARCHAR <> '3'",
+                                       table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 49);
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions start scanning at the OFFSET", "[rowid][limit]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    SECTION("Rows after the offset have the same values as in a full scan") {
+        const auto query_full = std::format("SELECT rowid, value FROM {}(seed=7) LIMIT 5000", table_function);
+        const auto query_offset =
+            std::format("SELECT rowid, value FROM {}(seed=7) LIMIT 100 OFFSET 4321", table_function);
+        const auto res_full = con.Query(query_full);
+        const auto res_offset = con.Query(query_offset);
+        REQUIRE_FALSE(res_full->HasError());
+        REQUIRE_FALSE(res_offset->HasError());
+        REQUIRE(res_offset->RowCount() == 100);
+        for (idx_t row = 0; row < 100; row++) {
+            CHECK(res_offset->GetValue(0, row).GetValue<int64_t>() == 4321 + row);
+            CHECK(res_offset->GetValue(1, row) == res_full->GetValue(1, 4321 + row));
+        }
+    }
+
+    SECTION("Huge offset does not generate the skipped rows") {
+        const auto query = std::format(
+            "SELECT MIN(rowid), MAX(rowid) FROM (SELECT rowid FROM {}(rows=9223372036854775807) "
+            "LIMIT 10 OFFSET 9000000000000000000)",
+            table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 9000000000000000000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 9000000000000000009);
+    }
+
+    SECTION("Offset combined with a rowid filter") {
+        const auto query =
+            std::format("SELECT rowid FROM {}() WHERE rowid >= 100 LIMIT 2 OFFSET 3", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 2);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 103);
+        CHECK(res->GetValue(0, 1).GetValue<int64_t>() == 104);
+    }
+
+    SECTION("Offset beyond the number of rows") {
+        const auto query = std::format("SELECT rowid FROM {}(rows=100) OFFSET 100", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->RowCount() == 0);
+    }
+
+    SECTION("Percentage limit is taken of all rows including the offset") {
+        const auto query = std::format("SELECT rowid FROM {}(rows=100) LIMIT 50% OFFSET 10", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 50);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10);
+        CHECK(res->GetValue(0, 49).GetValue<int64_t>() == 59);
+    }
+}
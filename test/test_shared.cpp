@@ -1,13 +1,16 @@
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/generators/catch_generators.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
 #include "faker_extension.hpp"
 #include "test_helpers/database_fixture.hpp"
 
+#include <cmath>
+
 using duckdb_faker::test_helpers::DatabaseFixture;
 
-// Currently we cut of at a maximum cardinality of 2^16
+// By default, we cut off at a cardinality of STANDARD_VECTOR_SIZE * 64
 TEST_CASE_METHOD(DatabaseFixture, "Should produce the number of rows specified by LIMIT", "[shared]") {
     const int32_t limit = GENERATE(0, 10, 100, 100000);
     const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
@@ -16,3 +19,233 @@ TEST_CASE_METHOD(DatabaseFixture, "Should produce the number of rows specified b
 
     REQUIRE(res->RowCount() == limit);
 }
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions accept a seed", "[shared]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    SECTION("Should produce the same values for the same seed") {
+        const auto query = std::format("SELECT value FROM {}(seed=42) LIMIT 1000", table_function);
+        const auto res1 = con.Query(query);
+        const auto res2 = con.Query(query);
+        REQUIRE_FALSE(res1->HasError());
+        REQUIRE_FALSE(res2->HasError());
+        REQUIRE(res1->RowCount() == 1000);
+        REQUIRE(res2->RowCount() == 1000);
+
+        for (idx_t row = 0; row < 1000; row++) {
+            REQUIRE(res1->GetValue(0, row) == res2->GetValue(0, row));
+        }
+    }
+
+    SECTION("Should produce different values for different seeds") {
+        const auto query = std::format("SELECT COUNT(*) FROM "
+                                       "(SELECT rowid, value FROM {0}(seed=1) LIMIT 1000) AS a "
+                                       "JOIN (SELECT rowid, value FROM {0}(seed=2) LIMIT 1000) AS b "
+                                       "ON a.rowid = b.rowid AND a.value <> b.value",
+                                       table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() > 0);
+    }
+
+    SECTION("Should produce the same values as setseed() for the same seed") {
+        const auto query = std::format("SELECT value FROM {}() LIMIT 1000", table_function);
+        con.Query("SELECT setseed(0.42)");
+        const auto res1 = con.Query(query);
+        con.Query("SELECT setseed(0.42)");
+        const auto res2 = con.Query(query);
+        REQUIRE_FALSE(res1->HasError());
+        REQUIRE_FALSE(res2->HasError());
+
+        for (idx_t row = 0; row < 1000; row++) {
+            REQUIRE(res1->GetValue(0, row) == res2->GetValue(0, row));
+        }
+    }
+
+    SECTION("Should compute the value of a row independently of the other rows") {
+        const auto query_full = std::format("SELECT value FROM {}(seed=7) LIMIT 100", table_function);
+        const auto query_single = std::format("SELECT value FROM {}(seed=7) WHERE rowid = 42", table_function);
+        const auto res_full = con.Query(query_full);
+        const auto res_single = con.Query(query_single);
+        REQUIRE_FALSE(res_full->HasError());
+        REQUIRE_FALSE(res_single->HasError());
+        REQUIRE(res_single->RowCount() == 1);
+        CHECK(res_full->GetValue(0, 42) == res_single->GetValue(0, 0));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions run in parallel", "[shared]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    SECTION("Should generate every rowid exactly once") {
+        con.Query("SET threads=4");
+        const auto query = std::format("SELECT COUNT(*), COUNT(DISTINCT rowid), MIN(rowid), MAX(rowid) FROM {}()",
+                                       table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+
+        const auto row_count = res->GetValue(0, 0).GetValue<int64_t>();
+        CHECK(row_count > 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == row_count);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == row_count - 1);
+    }
+
+    SECTION("Should produce the same values independent of the number of threads") {
+        const auto query = std::format("SELECT SUM(hash(rowid, value)) FROM {}(seed=42)", table_function);
+        con.Query("SET threads=1");
+        const auto res_single_threaded = con.Query(query);
+        con.Query("SET threads=4");
+        const auto res_multi_threaded = con.Query(query);
+        REQUIRE_FALSE(res_single_threaded->HasError());
+        REQUIRE_FALSE(res_multi_threaded->HasError());
+        CHECK(res_single_threaded->GetValue(0, 0) == res_multi_threaded->GetValue(0, 0));
+    }
+
+    SECTION("Should preserve the order of rows") {
+        con.Query("SET threads=4");
+        const auto query = std::format("SELECT rowid FROM {}() LIMIT 50000", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 50000);
+
+        for (idx_t row = 0; row < 50000; row++) {
+            REQUIRE(res->GetValue(0, row).GetValue<int64_t>() == static_cast<int64_t>(row));
+        }
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions accept a number of rows", "[shared]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    SECTION("Should produce exactly the number of rows specified") {
+        const uint64_t rows = GENERATE(0, 1, 2048, 2049, 1000000);
+        CAPTURE(rows);
+
+        const auto query = std::format("SELECT COUNT(*), MAX(rowid) FROM {}(rows={})", table_function, rows);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<uint64_t>() == rows);
+        if (rows > 0) {
+            CHECK(res->GetValue(1, 0).GetValue<uint64_t>() == rows - 1);
+        }
+    }
+
+    SECTION("Should accept up to 2^63 rows") {
+        const auto query = std::format("SELECT COUNT(*) FROM (FROM {}(rows=9223372036854775808) LIMIT 10)",
+                                       table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<uint64_t>() == 10);
+    }
+
+    SECTION("Should reject more than 2^63 rows") {
+        const auto query = std::format("FROM {}(rows=9223372036854775809)", table_function);
+        const auto res = con.Query(query);
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), Catch::Matchers::ContainsSubstring("rows must be less than or equal to 2^63"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "Generator functions accept a NULL probability", "[shared]") {
+    const std::string table_function = GENERATE("random_bool", "random_int", "random_string");
+    CAPTURE(table_function);
+
+    SECTION("Should produce no NULLs by default") {
+        const auto query = std::format("SELECT COUNT(*) FILTER (WHERE value IS NULL) FROM {}()", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should produce NULLs with the given probability") {
+        const double null_probability = GENERATE(0.1, 0.5, 0.9);
+        CAPTURE(null_probability);
+
+        constexpr uint32_t row_count = 100'000;
+        const auto query = std::format("SELECT COUNT(*) FILTER (WHERE value IS NULL) FROM {}(null_probability={}, "
+                                       "rows={})",
+                                       table_function,
+                                       null_probability,
+                                       row_count);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        const auto null_count = res->GetValue(0, 0).GetValue<int64_t>();
+        CAPTURE(null_count);
+        CHECK(std::abs(static_cast<double>(null_count) - null_probability * row_count) <= row_count * 0.01);
+    }
+
+    SECTION("Should produce only NULLs for probability 1") {
+        const auto query =
+            std::format("SELECT COUNT(value), COUNT(*) FROM {}(null_probability=1, rows=10000)", table_function);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 10000);
+    }
+
+    SECTION("Should produce the same non-NULL values as without NULLs") {
+        const auto query_without_nulls = std::format("SELECT value FROM {}(seed=3) LIMIT 3000", table_function);
+        const auto query_with_nulls =
+            std::format("SELECT value FROM {}(seed=3, null_probability=0.3) LIMIT 3000", table_function);
+        const auto res_without_nulls = con.Query(query_without_nulls);
+        const auto res_with_nulls = con.Query(query_with_nulls);
+        REQUIRE_FALSE(res_without_nulls->HasError());
+        REQUIRE_FALSE(res_with_nulls->HasError());
+        for (idx_t row = 0; row < 3000; row++) {
+            const auto value = res_with_nulls->GetValue(0, row);
+            if (!value.IsNull()) {
+                REQUIRE(value == res_without_nulls->GetValue(0, row));
+            }
+        }
+    }
+
+    SECTION("Should reject NULL probabilities outside of [0, 1]") {
+        const auto query = std::format("FROM {}(null_probability=1.5)", table_function);
+        const auto res = con.Query(query);
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), Catch::Matchers::ContainsSubstring("null_probability must be between 0 and 1"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "NULLs can be mixed into pooled and constant values", "[shared]") {
+    // These calls produce dictionary or constant vectors, which NULLs are added to without copying the values
+    const std::string call = GENERATE("random_choice(values=['red', 'green', 'blue'], seed=3",
+                                      "random_string(distinct=5, seed=3",
+                                      "random_string(min_length=20, max_length=20, distinct=1, seed=3",
+                                      "random_int(min=7, max=7, seed=3");
+    CAPTURE(call);
+
+    SECTION("Should produce the same non-NULL values as without NULLs") {
+        const auto res_without_nulls = con.Query(std::format("SELECT value FROM {}) LIMIT 3000", call));
+        const auto res_with_nulls =
+            con.Query(std::format("SELECT value FROM {}, null_probability=0.3) LIMIT 3000", call));
+        REQUIRE_FALSE(res_without_nulls->HasError());
+        REQUIRE_FALSE(res_with_nulls->HasError());
+        idx_t null_count = 0;
+        for (idx_t row = 0; row < 3000; row++) {
+            const auto value = res_with_nulls->GetValue(0, row);
+            if (value.IsNull()) {
+                null_count++;
+            } else {
+                REQUIRE(value == res_without_nulls->GetValue(0, row));
+            }
+        }
+        CAPTURE(null_count);
+        CHECK(null_count > 700);
+        CHECK(null_count < 1100);
+    }
+
+    SECTION("Should keep the number of distinct values") {
+        const auto query = std::format("SELECT COUNT(DISTINCT value), COUNT(*) - COUNT(value) > 0 "
+                                       "FROM {}, null_probability=0.5, rows=10000)",
+                                       call);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() <= 5);
+        CHECK(res->GetValue(1, 0).GetValue<bool>());
+    }
+}
@@ -51,7 +51,7 @@ TEST_CASE_METHOD(DatabaseFixture, "random_string", "[strings]") {
 
 TEST_CASE_METHOD(DatabaseFixture, "random_string length", "[strings]") {
     SECTION("Should produce strings of the specified length") {
-        const uint32_t length = GENERATE(1, 10, 100, 1000);
+        const uint32_t length = GENERATE(1, 10, 12, 13, 100, 1000);
 
         const auto query = std::format("FROM random_string(length={}) LIMIT {}", length, LIMIT);
         const auto res = con.Query(query);
@@ -64,6 +64,17 @@ TEST_CASE_METHOD(DatabaseFixture, "random_string length", "[strings]") {
         }
     }
 
+    SECTION("Should produce empty strings for length 0") {
+        const auto query = GENERATE("SELECT COUNT(*), MAX(LENGTH(value)) FROM random_string(length=0, rows=10000)",
+                                    "SELECT COUNT(*), MAX(LENGTH(value)) FROM random_string(max_length=0, rows=10000)");
+        CAPTURE(query);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+    }
+
     SECTION("Should reject invalid length arguments") {
         const auto res = con.Query("FROM random_string(length='invalid')");
         REQUIRE(res->HasError());
@@ -80,6 +91,17 @@ TEST_CASE_METHOD(DatabaseFixture, "random_string length", "[strings]") {
         CHECK_THAT(res->GetError(), ContainsSubstring("value is out of range"));
     }
 
+    SECTION("Should reject lengths that cannot be stored in a string") {
+        const auto query = GENERATE("FROM random_string(length=4294967296)",
+                                    "FROM random_string(max_length=4294967296)",
+                                    "FROM random_string(min_length=4294967296)");
+        CAPTURE(query);
+        const auto res = con.Query(query);
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("String length must be less than or equal to 4294967295"));
+    }
+
     SECTION("Should throw error when length and min/max length are both specified") {
         const auto query = GENERATE("FROM random_string(length=10, min_length=1)",
                                     "FROM random_string(length=10, max_length=5)",
@@ -185,28 +207,22 @@ TEST_CASE_METHOD(DatabaseFixture, "random_string length", "[strings]") {
 }
 
 TEST_CASE_METHOD(DatabaseFixture, "random_string length slow", "[strings][.slow]") {
-    SECTION("Should be able to produce strings with minimum_length UINT64_MAX") {
-        const auto query = std::format("FROM random_string(min_length={}) LIMIT 1", UINT64_MAX);
+    SECTION("Should be able to produce strings with the maximum string length") {
+        const auto query = std::format("FROM random_string(length={}) LIMIT 1", UINT32_MAX);
         const auto res = con.Query(query);
         const auto val = res->GetValue(0, 0).GetValue<std::string>();
-        REQUIRE(val.size() == UINT64_MAX);
+        REQUIRE(val.size() == UINT32_MAX);
     }
 
     SECTION("Should not overflow when calculating max_length for large min_length") {
-        // max_length should not overflow
-        auto [min_length, max_length] =
-            GENERATE(std::make_tuple<uint64_t, uint64_t>(UINT64_MAX / 2, UINT64_MAX),
-                     std::make_tuple<uint64_t, uint64_t>(UINT64_MAX / 2 + 5000, UINT64_MAX));
+        // The derived max_length must not overflow but is longer than any string can be
+        const uint64_t min_length = GENERATE(UINT64_MAX / 2, UINT64_MAX / 2 + 5000, UINT64_MAX);
 
-        const auto query =
-            std::format("FROM random_string(min_length={}, max_length={}) LIMIT 3", min_length, max_length);
+        const auto query = std::format("FROM random_string(min_length={}) LIMIT 3", min_length);
         const auto res = con.Query(query);
 
-        for (uint32_t row = 0; row < res->RowCount(); row++) {
-            const auto val = res->GetValue(0, row).GetValue<std::string>();
-            CHECK(val.size() >= min_length);
-            CHECK(val.size() <= max_length);
-        }
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("String length must be less than or equal to 4294967295"));
     }
 }
 
@@ -277,4 +293,102 @@ TEST_CASE_METHOD(DatabaseFixture, "random_string casing", "[strings]") {
         REQUIRE(res->HasError());
         CHECK_THAT(res->GetError(), ContainsSubstring("casing must be one of: lower, upper, mixed"));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_string distinct", "[strings]") {
+    SECTION("Should produce exactly the given number of distinct strings") {
+        const uint64_t distinct = GENERATE(1, 2, 100, 5000);
+        CAPTURE(distinct);
+
+        const auto query = std::format("SELECT COUNT(DISTINCT value), COUNT(*) FROM random_string(distinct={}, "
+                                       "min_length=10, rows=100000)",
+                                       distinct);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == distinct);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 100000);
+    }
+
+    SECTION("Should produce exactly the given number of distinct short strings") {
+        auto [parameters, distinct] = GENERATE(std::make_tuple<std::string, int64_t>("length=1", 26),
+                                               std::make_tuple<std::string, int64_t>("max_length=2", 700));
+        CAPTURE(parameters, distinct);
+
+        const auto query = std::format(
+            "SELECT COUNT(DISTINCT value) FROM random_string(distinct={}, {}, rows=100000)", distinct, parameters);
+        const auto res = con.Query(query);
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == distinct);
+    }
+
+    SECTION("Should respect the length parameters") {
+        const auto res = con.Query("SELECT MIN(LENGTH(value)), MAX(LENGTH(value)) "
+                                   "FROM random_string(distinct=50, min_length=13, max_length=15, casing='upper')");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() >= 13);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() <= 15);
+    }
+
+    SECTION("Should pick the strings with equal probability") {
+        const auto res = con.Query("SELECT MIN(cnt), MAX(cnt) FROM (SELECT COUNT(*) AS cnt "
+                                   "FROM random_string(distinct=4, min_length=10, rows=100000) GROUP BY value)");
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() >= 24000);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() <= 26000);
+    }
+
+    SECTION("Should produce the same strings for the same seed") {
+        const auto query = "SELECT list(value) FROM (SELECT value FROM random_string(distinct=10, seed=5) LIMIT 3000)";
+        const auto res1 = con.Query(query);
+        const auto res2 = con.Query(query);
+        REQUIRE_FALSE(res1->HasError());
+        REQUIRE_FALSE(res2->HasError());
+        CHECK(res1->GetValue(0, 0) == res2->GetValue(0, 0));
+    }
+
+    SECTION("Should reject invalid distinct arguments") {
+        const auto query = GENERATE("FROM random_string(distinct=0)", "FROM random_string(distinct=1048577)");
+        CAPTURE(query);
+        const auto res = con.Query(query);
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("distinct must be between 1 and 1048576"));
+    }
+
+    SECTION("Should reject pools of too many characters") {
+        const auto res = con.Query("FROM random_string(distinct=1000, min_length=2000000)");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(),
+                   ContainsSubstring("distinct * max_length must be less than or equal to 1073741824"));
+    }
+
+    SECTION("Should reject more distinct strings than the lengths allow") {
+        const auto res = con.Query("FROM random_string(distinct=53, length=1, casing='mixed')");
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("distinct must be at most 52"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_string statistics", "[strings][statistics]") {
+    SECTION("Should propagate the maximum string length") {
+        const auto res = con.Query("SELECT stats(value) FROM random_string(min_length=2, max_length=5) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        const auto stats = res->GetValue(0, 0).ToString();
+        CHECK_THAT(stats, ContainsSubstring("Max String Length: 5"));
+        CHECK_THAT(stats, ContainsSubstring("Has Null: false"));
+    }
+
+    SECTION("Should propagate the bounds of UUIDs") {
+        const auto res = con.Query("SELECT stats(value) FROM random_uuid() LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        const auto stats = res->GetValue(0, 0).ToString();
+        CHECK_THAT(stats, ContainsSubstring("Min: 00000000-0000-4000-8000-000000000000"));
+        CHECK_THAT(stats, ContainsSubstring("Max: ffffffff-ffff-4fff-bfff-ffffffffffff"));
+        CHECK_THAT(stats, ContainsSubstring("Has Null: false"));
+    }
+
+    SECTION("Should start the bounds of version 7 UUIDs at their first timestamp") {
+        const auto res = con.Query("SELECT stats(value) FROM random_uuid(version=7) LIMIT 1");
+        REQUIRE_FALSE(res->HasError());
+        CHECK_THAT(res->GetValue(0, 0).ToString(), ContainsSubstring("Min: 016f5e66-e800-7000-8000-000000000000"));
+    }
+}
@@ -0,0 +1,153 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/generators/catch_generators.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+#include "test_helpers/database_fixture.hpp"
+
+#include <cstdint>
+
+using Catch::Matchers::ContainsSubstring;
+using duckdb_faker::test_helpers::DatabaseFixture;
+
+TEST_CASE_METHOD(DatabaseFixture, "random_date", "[temporal]") {
+    SECTION("Should produce dates in the default range") {
+        const auto res = con.Query("SELECT typeof(ANY_VALUE(value)), MIN(value), MAX(value) "
+                                   "FROM random_date(rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "DATE");
+        CHECK(res->GetValue(1, 0).ToString() >= "1970-01-01");
+        CHECK(res->GetValue(2, 0).ToString() <= "2037-12-31");
+    }
+
+    SECTION("Should respect minimum and maximum") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value), COUNT(DISTINCT value) "
+                                   "FROM random_date(min='2024-02-27', max='2024-03-02', rows=10000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "2024-02-27");
+        CHECK(res->GetValue(1, 0).ToString() == "2024-03-02");
+        // Includes the leap day
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 5);
+    }
+
+    SECTION("Should produce a constant if minimum equals maximum") {
+        const auto res =
+            con.Query("SELECT COUNT(DISTINCT value), MIN(value) FROM random_date(min='2000-01-01', max='2000-01-01')");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1);
+        CHECK(res->GetValue(1, 0).ToString() == "2000-01-01");
+    }
+
+    SECTION("Should reject invalid ranges") {
+        auto [params, message] = GENERATE(
+            std::make_tuple("min='2024-01-02', max='2024-01-01'", "Minimum value must be less than or equal"),
+            std::make_tuple("max='infinity'", "Minimum and maximum value must be finite dates"));
+        CAPTURE(params);
+
+        const auto res = con.Query(std::format("SELECT value FROM random_date({})", params));
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_timestamp", "[temporal]") {
+    SECTION("Should produce timestamps in the default range") {
+        const auto res = con.Query("SELECT typeof(ANY_VALUE(value)), MIN(value), MAX(value) "
+                                   "FROM random_timestamp(rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "TIMESTAMP");
+        CHECK(res->GetValue(1, 0).ToString() >= "1970-01-01 00:00:00");
+        CHECK(res->GetValue(2, 0).ToString() <= "2037-12-31 23:59:59.999999");
+    }
+
+    SECTION("Should respect minimum and maximum with microsecond resolution") {
+        const auto res = con.Query("SELECT COUNT(*) FILTER (value < '2024-01-01 00:00:00.000001' OR "
+                                   "value > '2024-01-01 00:00:00.000010'), COUNT(DISTINCT value) "
+                                   "FROM random_timestamp(min='2024-01-01 00:00:00.000001', "
+                                   "max='2024-01-01 00:00:00.000010', rows=10000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 10);
+    }
+
+    SECTION("Should reject invalid ranges") {
+        auto [params, message] = GENERATE(
+            std::make_tuple("min='2024-01-02', max='2024-01-01'", "Minimum value must be less than or equal"),
+            std::make_tuple("min='-infinity'", "Minimum and maximum value must be finite timestamps"));
+        CAPTURE(params);
+
+        const auto res = con.Query(std::format("SELECT value FROM random_timestamp({})", params));
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring(message));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_time", "[temporal]") {
+    SECTION("Should produce times of the whole day by default") {
+        const auto res = con.Query("SELECT typeof(ANY_VALUE(value)), MIN(value) < '01:00:00', "
+                                   "MAX(value) > '23:00:00' FROM random_time(rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "TIME");
+        CHECK(res->GetValue(1, 0).GetValue<bool>());
+        CHECK(res->GetValue(2, 0).GetValue<bool>());
+    }
+
+    SECTION("Should respect minimum and maximum") {
+        const auto res = con.Query("SELECT MIN(value), MAX(value) "
+                                   "FROM random_time(min='12:00:00', max='12:00:05', rows=100000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() >= "12:00:00");
+        CHECK(res->GetValue(1, 0).ToString() <= "12:00:05");
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_interval", "[temporal]") {
+    SECTION("Should draw each component from its range") {
+        const auto res = con.Query("SELECT typeof(ANY_VALUE(value)), "
+                                   "MIN(datepart('month', value) + datepart('year', value) * 12), "
+                                   "MAX(datepart('month', value) + datepart('year', value) * 12), "
+                                   "MIN(datepart('day', value)), MAX(datepart('day', value)) "
+                                   "FROM random_interval(min=INTERVAL '1 month 2 days', "
+                                   "max=INTERVAL '3 months 4 days', rows=10000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "INTERVAL");
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 1);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 3);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == 2);
+        CHECK(res->GetValue(4, 0).GetValue<int64_t>() == 4);
+    }
+
+    SECTION("Should reject a component of minimum greater than maximum") {
+        const auto res = con.Query("SELECT value FROM random_interval(min=INTERVAL '2 days', max=INTERVAL '1 month')");
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("must be less than or equal to those of the maximum"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data temporal columns", "[temporal][mixed_types]") {
+    con.Query("CREATE TABLE events (d DATE, t TIME, ts TIMESTAMP, tz TIMESTAMPTZ, ts_s TIMESTAMP_S, "
+              "ts_ms TIMESTAMP_MS, ts_ns TIMESTAMP_NS, i INTERVAL)");
+
+    const auto insert_res =
+        con.Query("INSERT INTO events SELECT * FROM random_data(schema_source='events', rows=1000)");
+    REQUIRE_FALSE(insert_res->HasError());
+
+    const auto res = con.Query("SELECT COUNT(*) FROM events WHERE d BETWEEN '1970-01-01' AND '2037-12-31' "
+                               "AND ts::DATE BETWEEN '1970-01-01' AND '2037-12-31' "
+                               "AND ts_s::DATE BETWEEN '1970-01-01' AND '2037-12-31' "
+                               "AND ts_ms::DATE BETWEEN '1970-01-01' AND '2037-12-31' "
+                               "AND ts_ns::DATE BETWEEN '1970-01-01' AND '2037-12-31'");
+    REQUIRE_FALSE(res->HasError());
+    CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 1000);
+}
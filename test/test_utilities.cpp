@@ -1,6 +1,15 @@
 #include "catch2/catch_test_macros.hpp"
-#include "src/table_functions/probability_distributions.hpp"
-#include "src/table_functions/string_casing.hpp"
+#include "catch2/generators/catch_generators.hpp"
+#include "rng/bounded_int_kernel.hpp"
+#include "rng/counter_rng.hpp"
+#include "table_functions/probability_distributions.hpp"
+#include "table_functions/row_ranges.hpp"
+#include "table_functions/string_casing.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 using namespace duckdb_faker;
 
@@ -24,16 +33,32 @@ TEST_CASE("ProbabilityDistribution::FromString", "[utilities]") {
         REQUIRE(result3.value() == ProbabilityDistribution::Type::UNIFORM);
     }
 
-    SECTION("Should return nullopt for unknown distributions") {
+    SECTION("Should recognize normal distribution") {
         auto result1 = ProbabilityDistribution::FromString("normal");
-        auto result2 = ProbabilityDistribution::FromString("gaussian");
-        auto result3 = ProbabilityDistribution::FromString("invalid");
-        auto result4 = ProbabilityDistribution::FromString("");
+        auto result2 = ProbabilityDistribution::FromString("Gaussian");
+
+        REQUIRE(result1.has_value());
+        REQUIRE(result2.has_value());
+        REQUIRE(result1.value() == ProbabilityDistribution::Type::NORMAL);
+        REQUIRE(result2.value() == ProbabilityDistribution::Type::NORMAL);
+    }
+
+    SECTION("Should recognize zipf distribution") {
+        auto result1 = ProbabilityDistribution::FromString("zipf");
+        auto result2 = ProbabilityDistribution::FromString("Zipfian");
+
+        REQUIRE(result1.has_value());
+        REQUIRE(result2.has_value());
+        REQUIRE(result1.value() == ProbabilityDistribution::Type::ZIPF);
+        REQUIRE(result2.value() == ProbabilityDistribution::Type::ZIPF);
+    }
+
+    SECTION("Should return nullopt for unknown distributions") {
+        auto result1 = ProbabilityDistribution::FromString("invalid");
+        auto result2 = ProbabilityDistribution::FromString("");
 
         REQUIRE_FALSE(result1.has_value());
         REQUIRE_FALSE(result2.has_value());
-        REQUIRE_FALSE(result3.has_value());
-        REQUIRE_FALSE(result4.has_value());
     }
 }
 
@@ -72,10 +97,149 @@ TEST_CASE("string_casing_from_string", "[utilities]") {
     }
 }
 
-TEST_CASE("to_faker_casing", "[utilities]") {
-    SECTION("Should correctly convert StringCasing to faker casing") {
-        REQUIRE(to_faker_casing(StringCasing::Lower) == faker::string::StringCasing::Lower);
-        REQUIRE(to_faker_casing(StringCasing::Upper) == faker::string::StringCasing::Upper);
-        REQUIRE(to_faker_casing(StringCasing::Mixed) == faker::string::StringCasing::Mixed);
+TEST_CASE("CounterRng", "[utilities]") {
+    SECTION("Should produce the same words for the same seed, column and counter") {
+        const CounterRng rng1(42, 0);
+        const CounterRng rng2(42, 0);
+        for (uint64_t counter = 0; counter < 100; counter++) {
+            REQUIRE(rng1.Word(counter) == rng2.Word(counter));
+        }
+    }
+
+    SECTION("Should produce different words for different seeds and columns") {
+        const CounterRng rng(42, 0);
+        const CounterRng other_seed(43, 0);
+        const CounterRng other_column(42, 1);
+        CHECK(rng.Word(0) != other_seed.Word(0));
+        CHECK(rng.Word(0) != other_column.Word(0));
+    }
+
+    SECTION("FillWords should match Word") {
+        const CounterRng rng(42, 0);
+        uint64_t words[100];
+        rng.FillWords(1000, 100, words);
+        for (uint64_t i = 0; i < 100; i++) {
+            REQUIRE(words[i] == rng.Word(1000 + i));
+        }
+    }
+
+    SECTION("Should map words into the requested bounds") {
+        const CounterRng rng(42, 0);
+        for (uint64_t counter = 0; counter < 1000; counter++) {
+            const auto word = rng.Word(counter);
+            const double uniform = UniformDouble(word);
+            REQUIRE(uniform >= 0.0);
+            REQUIRE(uniform < 1.0);
+            REQUIRE(BoundedUint64(word, 7) < 7);
+        }
+        CHECK(BoundedUint64(UINT64_MAX, 10) == 9);
+        CHECK(BoundedUint64(0, 10) == 0);
+        CHECK(BoundedUint64(12345, 0) == 12345);
+        CHECK(ProbabilityThreshold(0.0) == 0);
+        CHECK(ProbabilityThreshold(0.5) == 1ULL << 63);
+        CHECK(ProbabilityThreshold(std::nextafter(1.0, 0.0)) == UINT64_MAX - 2047);
+    }
+}
+
+TEST_CASE("BoundedUint32Batch", "[utilities]") {
+    const CounterRng rng(42, 0);
+    constexpr uint64_t COUNT = 1000;
+    uint64_t words[COUNT];
+    rng.FillWords(uint64_t {0}, COUNT, words);
+    // Zero words are always biased unless the range is a power of two
+    words[3] = 0;
+    words[997] = 0;
+
+    const uint64_t range = GENERATE(1, 2, 7, 1000, (1ULL << 31) + 1, (1ULL << 32) - 1, 1ULL << 32);
+    const uint32_t base = GENERATE(0U, 5U, 0x80000000U);
+    CAPTURE(range, base);
+
+    uint32_t out[COUNT];
+    uint64_t rejected[COUNT];
+    const uint64_t num_rejected = BoundedUint32Batch(words, COUNT, range, base, out, rejected);
+
+    SECTION("Should match the scalar multiply-shift") {
+        for (uint64_t i = 0; i < COUNT; i++) {
+            REQUIRE(out[i] == base + static_cast<uint32_t>(BoundedUint64(words[i], range)));
+        }
+    }
+
+    SECTION("Should report exactly the biased words") {
+        const uint64_t threshold = (0 - range) % range;
+        std::vector<uint64_t> expected;
+        for (uint64_t i = 0; i < COUNT; i++) {
+            if (words[i] * range < threshold) {
+                expected.push_back(i);
+            }
+        }
+        CHECK(std::vector<uint64_t>(rejected, rejected + num_rejected) == expected);
+    }
+}
+
+TEST_CASE("UnbiasedBoundedUint32Batch", "[utilities]") {
+    const CounterRng rng(42, 0);
+    // More rows than the kernel handles at once
+    constexpr uint64_t COUNT = 5000;
+    std::vector<uint64_t> rowids(COUNT);
+    for (uint64_t i = 0; i < COUNT; i++) {
+        rowids[i] = i * 7 + 3;
+    }
+
+    const uint64_t range = GENERATE(1, 7, (1ULL << 31) + 1, 1ULL << 32);
+    const uint32_t base = GENERATE(0U, 5U);
+    CAPTURE(range, base);
+
+    std::vector<uint32_t> out(COUNT);
+    UnbiasedBoundedUint32Batch(rng, rowids.data(), COUNT, range, base, out.data());
+
+    SECTION("Should match the unbiased scalar mapping of every row") {
+        const uint64_t threshold = (0 - range) % range;
+        for (uint64_t i = 0; i < COUNT; i++) {
+            const uint64_t word = rng.Word(rowids[i]);
+            uint64_t expected = BoundedUint64(word, range);
+            if (word * range < threshold) {
+                RowStream stream = rng.Stream(rowids[i]);
+                expected = UnbiasedBoundedUint64(stream, range);
+            }
+            REQUIRE(out[i] == base + static_cast<uint32_t>(expected));
+        }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("RowRanges", "[utilities]") {
+    auto to_pairs = [](const RowRanges& ranges) {
+        std::vector<std::pair<uint64_t, uint64_t>> result;
+        for (const auto& range : ranges.Ranges()) {
+            result.emplace_back(range.start, range.end);
+        }
+        return result;
+    };
+    using Pairs = std::vector<std::pair<uint64_t, uint64_t>>;
+
+    SECTION("Should ignore empty ranges") {
+        CHECK(RowRanges::Range(5, 5).Ranges().empty());
+        CHECK(RowRanges::Range(6, 5).Ranges().empty());
+    }
+
+    SECTION("Should intersect ranges") {
+        auto ranges = RowRanges::Range(0, 10);
+        ranges.Union(RowRanges::Range(20, 30));
+        ranges.Intersect(RowRanges::Range(5, 25));
+        CHECK(to_pairs(ranges) == Pairs {{5, 10}, {20, 25}});
+        CHECK(ranges.Count() == 10);
+    }
+
+    SECTION("Should merge overlapping and adjacent ranges") {
+        auto ranges = RowRanges::Range(0, 10);
+        ranges.Union(RowRanges::Range(10, 15));
+        ranges.Union(RowRanges::Range(12, 20));
+        ranges.Union(RowRanges::Range(30, 40));
+        CHECK(to_pairs(ranges) == Pairs {{0, 20}, {30, 40}});
+    }
+
+    SECTION("Should build ranges from unsorted rowids with duplicates") {
+        const auto ranges = RowRanges::FromRowIds({7, 3, 4, 7, 100});
+        CHECK(to_pairs(ranges) == Pairs {{3, 5}, {7, 8}, {100, 101}});
+        CHECK(ranges.Count() == 4);
+    }
+}
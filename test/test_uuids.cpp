@@ -0,0 +1,84 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/generators/catch_generators.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+#include "test_helpers/database_fixture.hpp"
+
+#include <cstdint>
+
+using Catch::Matchers::ContainsSubstring;
+using duckdb_faker::test_helpers::DatabaseFixture;
+
+TEST_CASE_METHOD(DatabaseFixture, "random_uuid", "[uuids]") {
+    SECTION("Should set version and variant bits") {
+        const int32_t version = GENERATE(4, 7);
+        CAPTURE(version);
+
+        const auto query = std::format("SELECT typeof(ANY_VALUE(value)), "
+                                       "COUNT(*) FILTER (uuid_extract_version(value) <> {0}), "
+                                       "COUNT(*) FILTER (substr(value::VARCHAR, 20, 1) NOT IN ('8', '9', 'a', 'b')), "
+                                       "COUNT(DISTINCT value) "
+                                       "FROM random_uuid(version={0}, rows=100000)",
+                                       version);
+        const auto res = con.Query(query);
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "UUID");
+        CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(2, 0).GetValue<int64_t>() == 0);
+        CHECK(res->GetValue(3, 0).GetValue<int64_t>() == 100000);
+    }
+
+    SECTION("Should produce version 4 by default") {
+        const auto res = con.Query("SELECT DISTINCT uuid_extract_version(value) FROM random_uuid(rows=1000)");
+
+        REQUIRE_FALSE(res->HasError());
+        REQUIRE(res->RowCount() == 1);
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 4);
+    }
+
+    SECTION("Should increase version 7 UUIDs with the rowid") {
+        const auto res = con.Query("SELECT COUNT(*) FROM (SELECT value, lag(value) OVER (ORDER BY rowid) AS previous "
+                                   "FROM random_uuid(version=7, rows=100000)) WHERE value <= previous");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 0);
+    }
+
+    SECTION("Should encode a timestamp in version 7 UUIDs") {
+        const auto res = con.Query("SELECT MIN(uuid_extract_timestamp(value))::DATE "
+                                   "FROM random_uuid(version=7, rows=1000)");
+
+        REQUIRE_FALSE(res->HasError());
+        CHECK(res->GetValue(0, 0).ToString() == "2020-01-01");
+    }
+
+    SECTION("Should reject unsupported versions") {
+        const int32_t version = GENERATE(0, 1, 5, 8);
+        CAPTURE(version);
+
+        const auto res = con.Query(std::format("SELECT value FROM random_uuid(version={})", version));
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("version must be 4 or 7"));
+    }
+
+    SECTION("Should reject more version 7 UUIDs than their timestamp can represent") {
+        const auto res = con.Query("SELECT value FROM random_uuid(version=7, rows=1152921504606846976)");
+
+        REQUIRE(res->HasError());
+        CHECK_THAT(res->GetError(), ContainsSubstring("Version 7 UUIDs can be generated for at most"));
+    }
+}
+
+TEST_CASE_METHOD(DatabaseFixture, "random_data UUID columns", "[uuids][mixed_types]") {
+    con.Query("CREATE TABLE users (id UUID)");
+
+    const auto res = con.Query("SELECT COUNT(DISTINCT id), MIN(uuid_extract_version(id)) "
+                               "FROM random_data(schema_source='users', rows=10000)");
+
+    REQUIRE_FALSE(res->HasError());
+    CHECK(res->GetValue(0, 0).GetValue<int64_t>() == 10000);
+    CHECK(res->GetValue(1, 0).GetValue<int64_t>() == 4);
+}